@@ -0,0 +1,166 @@
+#include "TROOT.h"
+#include "TTree.h"
+#include "TFile.h"
+
+#include "fastJetUtil.h"
+#include "../utilities/systemUtil.h"
+#include "../utilities/particleTree.h"
+#include "../utilities/ArgumentParser.h"
+
+#include "fastjet/ClusterSequence.hh"
+#include "fastjet/PseudoJet.hh"
+#include "fastjet/Error.hh"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+std::vector<std::string> argOptions;
+
+/*
+ * measures the time spent in clustering per event for each clustering strategy.
+ * All events are converted into PseudoJet objects before the timing, so that only FastJet is timed, not the I/O.
+ * Input events are particleTree events, ex. thermal events from sampleToyEvents with a fixed multiplicity.
+ * The results can be used to tune the multiplicity thresholds of strategy "auto" in FASTJETUTIL
+ */
+void benchmarkClusterJets(std::string inputFileName = "particleTree.root", std::string treePath = "evtToy", int dR = 4);
+
+void benchmarkClusterJets(std::string inputFileName, std::string treePath, int dR)
+{
+    std::cout << "running benchmarkClusterJets()" << std::endl;
+
+    double jetRadius = (double)dR / 10;
+
+    std::cout << "##### Parameters #####" << std::endl;
+    std::cout << "inputFileName = " << inputFileName.c_str() << std::endl;
+    std::cout << "treePath = " << treePath.c_str() << std::endl;
+    std::cout << "jetRadius = " << jetRadius << std::endl;
+    std::cout << "##### Parameters - END #####" << std::endl;
+
+    // comma separated list of strategies to be timed
+    std::string strategies = (ArgumentParser::ParseOptionInputSingle("--strategies", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--strategies", argOptions) : "N2Plain,N2Tiled,NlnN,best,auto";
+    int nRepeat = (ArgumentParser::ParseOptionInputSingle("--nRepeat", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nRepeat", argOptions).c_str()) : 1;
+    int onlyCharged = (ArgumentParser::ParseOptionInputSingle("--onlyCharged", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--onlyCharged", argOptions).c_str()) : 0;
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "strategies = " << strategies.c_str() << std::endl;
+    std::cout << "nRepeat = " << nRepeat << std::endl;
+    std::cout << "onlyCharged = " << onlyCharged << std::endl;
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    std::vector<std::string> strategyNames = split(strategies, ",");
+    std::vector<int> strategyIndices;
+    for (int i = 0; i < (int)strategyNames.size(); ++i) {
+        int iStrategy = getStrategyIndex(strategyNames[i]);
+        if (iStrategy < 0) {
+            std::cout << "Strategy : " << strategyNames[i].c_str() << " is not recognized as a valid strategy. Exiting." << std::endl;
+            return;
+        }
+        strategyIndices.push_back(iStrategy);
+    }
+
+    TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
+
+    particleTree particles;
+    TTree* treeParticles = (TTree*)inputFile->Get(treePath.c_str());
+    particles.setupTreeForReading(treeParticles);
+
+    // convert all events before the timing
+    std::vector<std::vector<fastjet::PseudoJet> > events;
+    pseudoJetConverter fjConverter;
+    double sumMult = 0;
+
+    int nEvents = treeParticles->GetEntries();
+    std::cout << "nEvents = " << nEvents << std::endl;
+    events.resize(nEvents);
+    for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
+        treeParticles->GetEntry(iEvent);
+        particles.decode();
+
+        fjConverter.fill(particles, events[iEvent], (onlyCharged > 0));
+        sumMult += events[iEvent].size();
+    }
+    inputFile->Close();
+
+    double meanMult = (nEvents > 0) ? sumMult / nEvents : 0;
+    std::cout << "mean multiplicity = " << meanMult << std::endl;
+
+    fastjet::JetDefinition fjJetDefn(fastjet::antikt_algorithm, jetRadius);
+    jetDefinitionSelector fjJetDefnAuto(fjJetDefn, FASTJETUTIL::kAuto);
+    std::cout << "strategy chosen by auto for mean multiplicity = " << fjJetDefnAuto.get(meanMult).strategy_string().c_str() << std::endl;
+
+    std::cout << std::setw(10) << "strategy" << std::setw(15) << "meanMult" << std::setw(15) << "nJets"
+              << std::setw(20) << "time/event (ms)" << std::endl;
+    for (int i = 0; i < (int)strategyIndices.size(); ++i) {
+
+        jetDefinitionSelector fjJetDefnSelector(fjJetDefn, strategyIndices[i]);
+
+        // number of jets is used to check that all strategies give the same clustering
+        long long nJets = 0;
+        bool failed = false;
+        auto timeStart = std::chrono::steady_clock::now();
+        for (int iRepeat = 0; iRepeat < nRepeat && !failed; ++iRepeat) {
+            for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
+                try {
+                    fastjet::ClusterSequence clustSeq(events[iEvent], fjJetDefnSelector.get(events[iEvent].size()));
+                    nJets += clustSeq.inclusive_jets().size();
+                }
+                catch (fastjet::Error&) {
+                    // ex. NlnN is not available if FastJet is built without CGAL
+                    failed = true;
+                    break;
+                }
+            }
+        }
+        auto timeEnd = std::chrono::steady_clock::now();
+
+        if (failed) {
+            std::cout << std::setw(10) << strategyNames[i].c_str() << std::setw(15) << meanMult << std::setw(15) << "-"
+                      << std::setw(20) << "not available" << std::endl;
+            continue;
+        }
+
+        double timeMs = std::chrono::duration<double, std::milli>(timeEnd - timeStart).count();
+        double timePerEvent = (nEvents > 0) ? timeMs / (nEvents * nRepeat) : 0;
+        std::cout << std::setw(10) << strategyNames[i].c_str() << std::setw(15) << meanMult << std::setw(15) << nJets / nRepeat
+                  << std::setw(20) << timePerEvent << std::endl;
+    }
+
+    std::cout << "running benchmarkClusterJets() - END" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 4) {
+        benchmarkClusterJets(argv[1], argv[2], std::atoi(argv[3]));
+        return 0;
+    }
+    else if (nArgStr == 3) {
+        benchmarkClusterJets(argv[1], argv[2]);
+        return 0;
+    }
+    else if (nArgStr == 2) {
+        benchmarkClusterJets(argv[1]);
+        return 0;
+    }
+    else {
+        std::cout << "Usage : \n" <<
+                "./benchmarkClusterJets.exe <inputFileName> <treePath> <jetRadius>"
+                << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "strategies=<comma separated list of strategies : best, N2Plain, N2Tiled, NlnN, auto>" << std::endl;
+        std::cout << "nRepeat=<number of times each event is clustered>" << std::endl;
+        std::cout << "onlyCharged=<cluster only charged particles if > 0>" << std::endl;
+        return 1;
+    }
+}
@@ -4,25 +4,46 @@
   - jet algorithm
   - recombination scheme
    All input is given in a text file. Output is printed to stdout.
+ * In batch mode, the input file has many events and the jets are written into a fastJetTree, see clusterCardEvents().
  */
 #include "fastjet/ClusterSequence.hh"
 #include "TLorentzVector.h"
+#include "TFile.h"
+#include "TTree.h"
 
+#include "../fastJetTree.h"
+#include "../fastJetUtil.h"
 #include "../../utilities/systemUtil.h"
+#include "../../utilities/mappedFile.h"
 
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 #include <string>
 #include <vector>
 
 std::vector<double> parseListOfNumbers(std::string str);
+int parseListOfNumbers(const char* begin, const char* end, double* vals, int maxVals);
 int getJetAlgorithm(std::string str);
 int getRecombinationScheme(std::string str);
+fastjet::JetDefinition getJetDefinition(std::string strR, std::string strJetAlgo, std::string strRecombScheme);
+void clusterCardEvents(std::string inputFile, std::string outputFile, std::string treeName = "ak3Jets");
+void fillJets(const std::vector<fastjet::PseudoJet>& particles, const fastjet::JetDefinition& jetDefn, double minJetPt,
+              jetLoopBuffers& fjBuffers, fastJetTree& fjt);
 
 int main (int argc, char* argv[]) {
 
-    if (argc != 2) {
+    if (argc == 3 || argc == 4) {
+        if (argc == 4) clusterCardEvents(argv[1], argv[2], argv[3]);
+        else           clusterCardEvents(argv[1], argv[2]);
+        return 0;
+    }
+    else if (argc != 2) {
         std::cout << "Usage :"<< std::endl;
         std::cout << "./fastjet-general.exe <inputFile>" << std::endl;
+        std::cout << "./fastjet-general.exe <inputFile> <outputFile> <treeName>   (batch mode, multi-event input)" << std::endl;
         return 1;
     }
 
@@ -72,37 +93,7 @@ int main (int argc, char* argv[]) {
         }
     }
 
-    double R = 0.3;
-    int jetAlgo = -1;
-    int recombScheme = -1;
-
-    if (strR.size() == 0) {
-        std::cout << "No or invalid distance parameter is given. Using default : R = " << R << std::endl;
-    }
-    else {
-        R = std::atof(strR.c_str());
-        std::cout << "R = " << R << std::endl;
-    }
-
-    jetAlgo = getJetAlgorithm(strJetAlgo);
-    if (jetAlgo == -1) {
-        std::cout << "No or invalid jet algorithm is given : " << strJetAlgo.c_str() << std::endl;
-        jetAlgo = fastjet::JetAlgorithm::antikt_algorithm;
-        std::cout << "Using default : jet algorithm = antikt_algorithm" << std::endl;
-    }
-    else {
-        std::cout << "jet algorithm = " << strJetAlgo.c_str() << std::endl;
-    }
-
-    recombScheme = getRecombinationScheme(strRecombScheme);
-    if (recombScheme == -1) {
-        std::cout << "No or invalid recombination scheme is given : " << strRecombScheme.c_str() << std::endl;
-        recombScheme = fastjet::RecombinationScheme::E_scheme;
-        std::cout << "Using default : recombination scheme = E_scheme" << std::endl;
-    }
-    else {
-        std::cout << "recombination scheme = " << strRecombScheme.c_str() << std::endl;
-    }
+    fastjet::JetDefinition jet_def = getJetDefinition(strR, strJetAlgo, strRecombScheme);
 
     std::cout << "List of given particles : {pt, eta, phi, mass} --> {px, py, pz, E}" << std::endl;
     int nParticles = lorentzVecs.size();
@@ -122,9 +113,6 @@ int main (int argc, char* argv[]) {
         pseudoJets.push_back(fastjet::PseudoJet(lorentzVecs[i].Px(),  lorentzVecs[i].Py(),  lorentzVecs[i].Pz(), lorentzVecs[i].E()));
     }
 
-    fastjet::JetDefinition jet_def((fastjet::JetAlgorithm)jetAlgo, R);
-    jet_def.set_recombination_scheme((fastjet::RecombinationScheme)recombScheme);
-
     // run the clustering, extract the jets
     fastjet::ClusterSequence cs(pseudoJets, jet_def);
     std::vector<fastjet::PseudoJet> jets = sorted_by_pt(cs.inclusive_jets());
@@ -149,6 +137,263 @@ int main (int argc, char* argv[]) {
     return 0;
 } 
 
+/*
+ * batch mode : clusters each event of a multi-event input file and writes the jets into a fastJetTree.
+ * The syntax of the input file is the same as for a single card, in addition
+ *   - a line starting with "Event:" starts a new event. Particle lines before the first "Event:" line form an event.
+ *     An event without particles is written as an entry without jets, so that entry i is always event i.
+ *   - "MinJetPt:<x>" gives the minimum jet pt, default is 0.
+ *   - the settings (R, JetAlgorithm, RecombinationScheme, MinJetPt) must be given before the first particle or
+ *     "Event:" line. Settings after that are ignored.
+ * The input file is memory-mapped and each line is parsed in place without copying it into a std::string,
+ * numbers are parsed with std::from_chars.
+ * Constituents of the jets are written as well, constidx is the index of the particle line within the event.
+ */
+void clusterCardEvents(std::string inputFile, std::string outputFile, std::string treeName)
+{
+    std::cout << "running clusterCardEvents()" << std::endl;
+    std::cout << "inputFile = " << inputFile.c_str() << std::endl;
+    std::cout << "outputFile = " << outputFile.c_str() << std::endl;
+    std::cout << "treeName = " << treeName.c_str() << std::endl;
+
+    mappedFile card;
+    if (!card.open(inputFile)) {
+        std::cout << "Input file : " << inputFile.c_str() << " could not be opened. Exiting." << std::endl;
+        return;
+    }
+
+    TFile* output = new TFile(outputFile.c_str(), "RECREATE");
+    TTree* jetTree = new TTree(treeName.c_str(), Form("jets clustered from %s", inputFile.c_str()));
+    fastJetTree fjt;
+    fjt.branchTree(jetTree);
+    fjt.branchTreeConstituents(jetTree);
+
+    std::string strR = "";
+    std::string strJetAlgo = "";
+    std::string strRecombScheme = "";
+    double minJetPt = 0;
+    fastjet::JetDefinition jetDefn;
+    bool settingsDone = false;
+    int nIgnoredSettings = 0;
+    int nInvalidLines = 0;
+
+    std::vector<fastjet::PseudoJet> particles;
+    jetLoopBuffers fjBuffers;
+    bool eventStarted = false;
+    int nEvents = 0;
+    long long nParticlesTotal = 0;
+
+    double timeClusterMs = 0;
+    auto timeStart = std::chrono::steady_clock::now();
+
+    const char* pos = card.data();
+    const char* fileEnd = pos + card.size();
+    while (true) {
+
+        // end of the file is treated like an "Event:" line so that the last event is written
+        bool isFileEnd = (pos >= fileEnd);
+        const char* begin = pos;
+        const char* end = pos;
+        if (!isFileEnd) {
+            const char* lineEnd = (const char*)std::memchr(pos, '\n', fileEnd - pos);
+            if (lineEnd == 0) lineEnd = fileEnd;
+            pos = lineEnd + 1;
+
+            // the portion following a "#" is ignored
+            end = (const char*)std::memchr(begin, '#', lineEnd - begin);
+            if (end == 0) end = lineEnd;
+
+            while (begin < end && std::isspace((unsigned char)*begin)) ++begin;
+            while (end > begin && std::isspace((unsigned char)*(end-1))) --end;
+            if (begin == end) continue;
+        }
+
+        bool isEventLine = isFileEnd || (end - begin >= 6 && std::strncmp(begin, "Event:", 6) == 0);
+        bool isSettingLine = !isEventLine && std::isalpha((unsigned char)*begin);
+
+        if (isSettingLine) {
+            std::string in(begin, end);
+            if (settingsDone) {
+                nIgnoredSettings++;
+            }
+            else if (startsWith(in, "R:")) {
+                strR = trim(in.substr(std::string("R:").size()));
+            }
+            else if (startsWith(in, "JetAlgorithm:")) {
+                strJetAlgo = trim(in.substr(std::string("JetAlgorithm:").size()));
+            }
+            else if (startsWith(in, "RecombinationScheme:")) {
+                strRecombScheme = trim(in.substr(std::string("RecombinationScheme:").size()));
+            }
+            else if (startsWith(in, "MinJetPt:")) {
+                minJetPt = std::atof(trim(in.substr(std::string("MinJetPt:").size())).c_str());
+            }
+            continue;
+        }
+
+        if (!settingsDone) {
+            jetDefn = getJetDefinition(strR, strJetAlgo, strRecombScheme);
+            std::cout << "minJetPt = " << minJetPt << std::endl;
+            std::cout << "Clustering with " << jetDefn.description() << std::endl;
+            settingsDone = true;
+        }
+
+        if (isEventLine) {
+            if (eventStarted || particles.size() > 0) {
+                auto timeClusterStart = std::chrono::steady_clock::now();
+                fillJets(particles, jetDefn, minJetPt, fjBuffers, fjt);
+                timeClusterMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeClusterStart).count();
+                jetTree->Fill();
+                nEvents++;
+                nParticlesTotal += particles.size();
+                particles.clear();
+            }
+            if (isFileEnd) break;
+            eventStarted = true;
+            continue;
+        }
+
+        // pt, eta, phi, mass
+        double vals[4];
+        if (parseListOfNumbers(begin, end, vals, 4) != 4) {
+            nInvalidLines++;
+            continue;
+        }
+
+        double px = vals[0] * std::cos(vals[2]);
+        double py = vals[0] * std::sin(vals[2]);
+        double pz = vals[0] * std::sinh(vals[1]);
+        double e = std::sqrt(px*px + py*py + pz*pz + vals[3]*vals[3]);
+        particles.push_back(fastjet::PseudoJet(px, py, pz, e));
+        particles.back().set_user_index(particles.size() - 1);
+    }
+
+    double timeTotalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - timeStart).count();
+
+    std::cout << "nEvents = " << nEvents << std::endl;
+    std::cout << "nParticles = " << nParticlesTotal << std::endl;
+    if (nIgnoredSettings > 0) {
+        std::cout << "WARNING : " << nIgnoredSettings << " settings lines after the first event are ignored." << std::endl;
+    }
+    if (nInvalidLines > 0) {
+        std::cout << "WARNING : " << nInvalidLines << " lines are neither particles nor settings, they are ignored." << std::endl;
+    }
+    std::cout << "time spent in clustering (ms) = " << timeClusterMs << std::endl;
+    std::cout << "time spent in parsing and writing (ms) = " << timeTotalMs - timeClusterMs << std::endl;
+
+    output->Write("", TObject::kOverwrite);
+    std::cout << "Closing the output file" << std::endl;
+    output->Close();
+
+    std::cout << "running clusterCardEvents() - END" << std::endl;
+}
+
+/*
+ * clusters "particles" and fills the jets with pt > minJetPt and their constituents into "fjt"
+ */
+void fillJets(const std::vector<fastjet::PseudoJet>& particles, const fastjet::JetDefinition& jetDefn, double minJetPt,
+              jetLoopBuffers& fjBuffers, fastJetTree& fjt)
+{
+    fjt.clearEvent();
+
+    fastjet::ClusterSequence clustSeq(particles, jetDefn);
+    fillSortedInclusiveJets(clustSeq, minJetPt, fjBuffers.jets);
+
+    int nJets = fjBuffers.jets.size();
+    fjt.reserve(nJets);
+    for (int i = 0; i < nJets; ++i) {
+        const fastjet::PseudoJet& jet = fjBuffers.jets[i];
+
+        fjt.rawpt->push_back(jet.pt());
+        fjt.jetpt->push_back(jet.pt());
+        fjt.jeteta->push_back(jet.eta());
+        fjt.rawphi->push_back(jet.phi_std());
+        fjt.jetphi->push_back(jet.phi_std());
+        fjt.nJet++;
+
+        fillConstituents(jet, fjBuffers.constituents);
+        fjt.constoffset->push_back(fjt.constidx->size());
+        int nConstituents = fjBuffers.constituents.size();
+        for (int j = 0; j < nConstituents; ++j) {
+            fjt.constidx->push_back(fjBuffers.constituents[j].user_index());
+        }
+    }
+    fjt.constoffset->push_back(fjt.constidx->size());
+}
+
+/*
+ * parses a list of numbers separated by commas and/or whitespace in [begin, end) without copying the characters.
+ * The first "maxVals" numbers are written into "vals".
+ * returns the number of numbers in the list, -1 if the list has anything else than numbers.
+ */
+int parseListOfNumbers(const char* begin, const char* end, double* vals, int maxVals)
+{
+    int n = 0;
+    const char* p = begin;
+    while (p < end) {
+        if (*p == ',' || std::isspace((unsigned char)*p)) {
+            ++p;
+            continue;
+        }
+        // from_chars does not accept a leading "+"
+        if (*p == '+') ++p;
+
+        double val = 0;
+        std::from_chars_result res = std::from_chars(p, end, val);
+        if (res.ec != std::errc()) return -1;
+
+        if (n < maxVals) vals[n] = val;
+        n++;
+        p = res.ptr;
+    }
+
+    return n;
+}
+
+/*
+ * jet definition from the values of "R:", "JetAlgorithm:", "RecombinationScheme:" lines,
+ * defaults are used for empty or invalid values
+ */
+fastjet::JetDefinition getJetDefinition(std::string strR, std::string strJetAlgo, std::string strRecombScheme)
+{
+    double R = 0.3;
+    int jetAlgo = -1;
+    int recombScheme = -1;
+
+    if (strR.size() == 0) {
+        std::cout << "No or invalid distance parameter is given. Using default : R = " << R << std::endl;
+    }
+    else {
+        R = std::atof(strR.c_str());
+        std::cout << "R = " << R << std::endl;
+    }
+
+    jetAlgo = getJetAlgorithm(strJetAlgo);
+    if (jetAlgo == -1) {
+        std::cout << "No or invalid jet algorithm is given : " << strJetAlgo.c_str() << std::endl;
+        jetAlgo = fastjet::JetAlgorithm::antikt_algorithm;
+        std::cout << "Using default : jet algorithm = antikt_algorithm" << std::endl;
+    }
+    else {
+        std::cout << "jet algorithm = " << strJetAlgo.c_str() << std::endl;
+    }
+
+    recombScheme = getRecombinationScheme(strRecombScheme);
+    if (recombScheme == -1) {
+        std::cout << "No or invalid recombination scheme is given : " << strRecombScheme.c_str() << std::endl;
+        recombScheme = fastjet::RecombinationScheme::E_scheme;
+        std::cout << "Using default : recombination scheme = E_scheme" << std::endl;
+    }
+    else {
+        std::cout << "recombination scheme = " << strRecombScheme.c_str() << std::endl;
+    }
+
+    fastjet::JetDefinition jet_def((fastjet::JetAlgorithm)jetAlgo, R);
+    jet_def.set_recombination_scheme((fastjet::RecombinationScheme)recombScheme);
+
+    return jet_def;
+}
+
 std::vector<double> parseListOfNumbers(std::string str)
 {
     if(str.empty())
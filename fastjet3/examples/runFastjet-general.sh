@@ -5,7 +5,10 @@ fastjet3bin=$FASTJET3"/bin"
 progExe="./fastjet-general.exe"
 progCode="${progExe/.exe/.cc}"
 
-g++ $progCode -o $progExe $(root-config --cflags --libs) `${fastjet3bin}/fastjet-config --cxxflags --libs --plugins` || exit 1
+# RNTuple library (ROOT >= 6.32), used by the RNTuple backend of utilities/storageUtil.h
+rootNTupleLib=$(test -e $(root-config --libdir)/libROOTNTuple.so && echo -lROOTNTuple)
+
+g++ $progCode -o $progExe $(root-config --cflags --libs) $rootNTupleLib `${fastjet3bin}/fastjet-config --cxxflags --libs --plugins` || exit 1
 
 set +x
 
@@ -28,3 +31,12 @@ do
   echo "$progExe $inputCard &> $progOutput &"
 done
 
+
+## batch mode : multi-event input, jets are written into a fastJetTree
+inputEvents="./input/events1.txt"
+nameTmp=$(basename ${inputEvents})
+nameTmp="${nameTmp/.txt/}"
+progOutputRoot="./output/fastjet-general-"${nameTmp}".root"
+progOutput="${progOutputRoot/.root/.log}"
+$progExe $inputEvents $progOutputRoot ak3Jets &> $progOutput &
+echo "$progExe $inputEvents $progOutputRoot ak3Jets &> $progOutput &"
@@ -4,6 +4,11 @@
 #include <TTree.h>
 #include <TBranch.h>
 
+#include "../utilities/flatLayoutUtil.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/precisionUtil.h"
+
+#include <iostream>
 #include <vector>
 
 class fastJetTree {
@@ -16,11 +21,83 @@ public :
     rawpt = 0;
     rawphi = 0;
 
+    constoffset = 0;
+    constidx = 0;
+
+    partonidx = 0;
+    partonid = 0;
+    partonoutidx = 0;
+    partondr = 0;
+
+    rho = 0;
+    jetarea = 0;
+
+    wtaeta = 0;
+    wtaphi = 0;
+
+    nconst = 0;
+    ptd = 0;
+    lambda05 = 0;
+    lambda10 = 0;
+    lambda20 = 0;
+    sdzg = 0;
+    sdrg = 0;
+
+    matchidx = 0;
+    matchdr = 0;
+
+    b_nJet = 0;
+    b_jetpt = 0;
+    b_jeteta = 0;
+    b_jetphi = 0;
+    b_rawpt = 0;
+    b_rawphi = 0;
+    b_constoffset = 0;
+    b_constidx = 0;
+    b_partonidx = 0;
+    b_partonid = 0;
+    b_partonoutidx = 0;
+    b_partondr = 0;
+    b_rho = 0;
+    b_jetarea = 0;
+    b_wtaeta = 0;
+    b_wtaphi = 0;
+    b_nconst = 0;
+    b_ptd = 0;
+    b_lambda05 = 0;
+    b_lambda10 = 0;
+    b_lambda20 = 0;
+    b_sdzg = 0;
+    b_sdrg = 0;
+    b_matchidx = 0;
+    b_matchdr = 0;
+
+    flatCapacity = 0;
+    reducedPrecision = 0;
   };
   ~fastJetTree(){};
   void setupTreeForReading(TTree *t);
+  void setupTreeForReading(storageReader& r);
   void branchTree(TTree *t);
+  void branchTree(storageWriter& w);
+  void branchTreeConstituents(TTree *t);
+  void branchTreeConstituents(storageWriter& w);
+  void branchTreeParton(TTree *t);
+  void branchTreeParton(storageWriter& w);
+  void branchTreeRho(TTree *t);
+  void branchTreeRho(storageWriter& w);
+  void branchTreeWTA(TTree *t);
+  void branchTreeWTA(storageWriter& w);
+  void branchTreeSubstructure(TTree *t);
+  void branchTreeSubstructure(storageWriter& w);
+  void branchTreeMatch(TTree *t);
+  void branchTreeMatch(storageWriter& w);
   void clearEvent();
+  void reserve(int n);
+  void setFlatLayout(int capacity);
+  void setReducedPrecision(int value);
+  void encode();
+  void decode();
 
   // Declaration of leaf types
   Int_t           nJet;
@@ -29,6 +106,32 @@ public :
   std::vector<float>   *jetphi;
   std::vector<float>   *rawpt;     // jet pt before any modification
   std::vector<float>   *rawphi;    // jet phi before any modification
+  // optional : jet constituents
+  // constituents of jet i are constidx[constoffset[i]], ..., constidx[constoffset[i+1]-1]
+  std::vector<int>     *constoffset;   // nJet+1 entries
+  std::vector<int>     *constidx;      // index of the constituent in the source event
+  // optional : matching to the particles from hard scattering (index 5 or 6 in Pythia event)
+  std::vector<int>     *partonidx;     // index of the closest hard scattering particle in eta-phi
+  std::vector<int>     *partonid;      // PDG id of that particle, ex. 21 for gluon
+  std::vector<int>     *partonoutidx;  // index of the leading outgoing daughter of that particle
+  std::vector<float>   *partondr;      // dR between jet and that particle
+  // optional : background subtraction
+  Float_t              rho;        // median background pt density of the event
+  std::vector<float>   *jetarea;
+  // optional : winner-take-all axis of jets clustered with E-scheme
+  std::vector<float>   *wtaeta;
+  std::vector<float>   *wtaphi;
+  // optional : substructure
+  std::vector<int>     *nconst;    // number of constituents
+  std::vector<float>   *ptd;       // sqrt(sum pt_i^2) / sum pt_i
+  std::vector<float>   *lambda05;  // angularity sum z_i (dR_i/R)^beta with beta = 0.5
+  std::vector<float>   *lambda10;  // beta = 1, jet width
+  std::vector<float>   *lambda20;  // beta = 2, related to jet mass
+  std::vector<float>   *sdzg;      // soft drop groomed momentum fraction, -1 if no splitting passes
+  std::vector<float>   *sdrg;      // soft drop groomed radius, -1 if no splitting passes
+  // optional : matching to the jets of another tree clustered from the same event, ex. charged jets to full jets
+  std::vector<int>     *matchidx;  // index of the matched jet in the other tree, -1 if not matched
+  std::vector<float>   *matchdr;   // dR between the jet and the matched jet, -1 if not matched
 
   // List of branches
   TBranch        *b_nJet;   //!
@@ -37,27 +140,282 @@ public :
   TBranch        *b_jetphi;   //!
   TBranch        *b_rawpt;   //!
   TBranch        *b_rawphi;   //!
+  TBranch        *b_constoffset;   //!
+  TBranch        *b_constidx;   //!
+  TBranch        *b_partonidx;   //!
+  TBranch        *b_partonid;   //!
+  TBranch        *b_partonoutidx;   //!
+  TBranch        *b_partondr;   //!
+  TBranch        *b_rho;   //!
+  TBranch        *b_jetarea;   //!
+  TBranch        *b_wtaeta;   //!
+  TBranch        *b_wtaphi;   //!
+  TBranch        *b_nconst;   //!
+  TBranch        *b_ptd;   //!
+  TBranch        *b_lambda05;   //!
+  TBranch        *b_lambda10;   //!
+  TBranch        *b_lambda20;   //!
+  TBranch        *b_sdzg;   //!
+  TBranch        *b_sdrg;   //!
+  TBranch        *b_matchidx;   //!
+  TBranch        *b_matchdr;   //!
+
+  // 0 for vector branches, otherwise the branches with one entry per jet are C arrays with counter nJet,
+  // ex. "jetpt[nJet]/F", and this is the number of jets the arrays have space for.
+  // Constituent branches are always vectors as their size is not the number of jets.
+  int flatCapacity;
+  // 0 for full precision, otherwise the jet kinematics have truncated mantissas, see precisionUtil.h.
+  // The branches are still floats and need no decoding.
+  int reducedPrecision;
+  // encode() must be called before Fill() and decode() after GetEntry() for the flat layout and the reduced precision.
+
+private :
+  bool bindFlatLayout();
+
+  flatReadBuffers flatBuffers;
 };
 
 void fastJetTree::setupTreeForReading(TTree *t)
 {
-    // Set branch addresses and branch pointers
+    // Set branch addresses and branch pointers, the layout of the tree is detected
     if (t->GetBranch("nJet")) t->SetBranchAddress("nJet", &nJet, &b_nJet);
-    if (t->GetBranch("jetpt")) t->SetBranchAddress("jetpt", &jetpt, &b_jetpt);
-    if (t->GetBranch("jeteta")) t->SetBranchAddress("jeteta", &jeteta, &b_jeteta);
-    if (t->GetBranch("jetphi")) t->SetBranchAddress("jetphi", &jetphi, &b_jetphi);
-    if (t->GetBranch("rawpt")) t->SetBranchAddress("rawpt", &rawpt, &b_rawpt);
-    if (t->GetBranch("rawphi")) t->SetBranchAddress("rawphi", &rawphi, &b_rawphi);
+    setBranchAddressAnyLayout(t, "jetpt", jetpt, &b_jetpt, flatBuffers);
+    setBranchAddressAnyLayout(t, "jeteta", jeteta, &b_jeteta, flatBuffers);
+    setBranchAddressAnyLayout(t, "jetphi", jetphi, &b_jetphi, flatBuffers);
+    setBranchAddressAnyLayout(t, "rawpt", rawpt, &b_rawpt, flatBuffers);
+    setBranchAddressAnyLayout(t, "rawphi", rawphi, &b_rawphi, flatBuffers);
+    setBranchAddressAnyLayout(t, "constoffset", constoffset, &b_constoffset, flatBuffers);
+    setBranchAddressAnyLayout(t, "constidx", constidx, &b_constidx, flatBuffers);
+    setBranchAddressAnyLayout(t, "partonidx", partonidx, &b_partonidx, flatBuffers);
+    setBranchAddressAnyLayout(t, "partonid", partonid, &b_partonid, flatBuffers);
+    setBranchAddressAnyLayout(t, "partonoutidx", partonoutidx, &b_partonoutidx, flatBuffers);
+    setBranchAddressAnyLayout(t, "partondr", partondr, &b_partondr, flatBuffers);
+    if (t->GetBranch("rho")) t->SetBranchAddress("rho", &rho, &b_rho);
+    setBranchAddressAnyLayout(t, "jetarea", jetarea, &b_jetarea, flatBuffers);
+    setBranchAddressAnyLayout(t, "wtaeta", wtaeta, &b_wtaeta, flatBuffers);
+    setBranchAddressAnyLayout(t, "wtaphi", wtaphi, &b_wtaphi, flatBuffers);
+    setBranchAddressAnyLayout(t, "nconst", nconst, &b_nconst, flatBuffers);
+    setBranchAddressAnyLayout(t, "ptd", ptd, &b_ptd, flatBuffers);
+    setBranchAddressAnyLayout(t, "lambda05", lambda05, &b_lambda05, flatBuffers);
+    setBranchAddressAnyLayout(t, "lambda10", lambda10, &b_lambda10, flatBuffers);
+    setBranchAddressAnyLayout(t, "lambda20", lambda20, &b_lambda20, flatBuffers);
+    setBranchAddressAnyLayout(t, "sdzg", sdzg, &b_sdzg, flatBuffers);
+    setBranchAddressAnyLayout(t, "sdrg", sdrg, &b_sdrg, flatBuffers);
+    setBranchAddressAnyLayout(t, "matchidx", matchidx, &b_matchidx, flatBuffers);
+    setBranchAddressAnyLayout(t, "matchdr", matchdr, &b_matchdr, flatBuffers);
+}
+
+/*
+ * reads either a TTree or an RNTuple
+ */
+void fastJetTree::setupTreeForReading(storageReader& r)
+{
+    if (r.tree) {
+        setupTreeForReading(r.tree);
+        return;
+    }
+    r.setBranchAddress("nJet", &nJet);
+    r.setBranchAddress("jetpt", jetpt);
+    r.setBranchAddress("jeteta", jeteta);
+    r.setBranchAddress("jetphi", jetphi);
+    r.setBranchAddress("rawpt", rawpt);
+    r.setBranchAddress("rawphi", rawphi);
+    r.setBranchAddress("constoffset", constoffset);
+    r.setBranchAddress("constidx", constidx);
+    r.setBranchAddress("partonidx", partonidx);
+    r.setBranchAddress("partonid", partonid);
+    r.setBranchAddress("partonoutidx", partonoutidx);
+    r.setBranchAddress("partondr", partondr);
+    r.setBranchAddress("rho", &rho);
+    r.setBranchAddress("jetarea", jetarea);
+    r.setBranchAddress("wtaeta", wtaeta);
+    r.setBranchAddress("wtaphi", wtaphi);
+    r.setBranchAddress("nconst", nconst);
+    r.setBranchAddress("ptd", ptd);
+    r.setBranchAddress("lambda05", lambda05);
+    r.setBranchAddress("lambda10", lambda10);
+    r.setBranchAddress("lambda20", lambda20);
+    r.setBranchAddress("sdzg", sdzg);
+    r.setBranchAddress("sdrg", sdrg);
+    r.setBranchAddress("matchidx", matchidx);
+    r.setBranchAddress("matchdr", matchdr);
 }
 
 void fastJetTree::branchTree(TTree *t)
 {
-    t->Branch("nJet", &nJet);
-    t->Branch("jetpt", &jetpt);
-    t->Branch("jeteta", &jeteta);
-    t->Branch("jetphi", &jetphi);
-    t->Branch("rawpt", &rawpt);
-    t->Branch("rawphi", &rawphi);
+    b_nJet = t->Branch("nJet", &nJet);
+    if (flatCapacity > 0) {
+        b_jetpt = branchFlat(t, "jetpt", "nJet", jetpt, flatCapacity);
+        b_jeteta = branchFlat(t, "jeteta", "nJet", jeteta, flatCapacity);
+        b_jetphi = branchFlat(t, "jetphi", "nJet", jetphi, flatCapacity);
+        b_rawpt = branchFlat(t, "rawpt", "nJet", rawpt, flatCapacity);
+        b_rawphi = branchFlat(t, "rawphi", "nJet", rawphi, flatCapacity);
+        return;
+    }
+    b_jetpt = t->Branch("jetpt", &jetpt);
+    b_jeteta = t->Branch("jeteta", &jeteta);
+    b_jetphi = t->Branch("jetphi", &jetphi);
+    b_rawpt = t->Branch("rawpt", &rawpt);
+    b_rawphi = t->Branch("rawphi", &rawphi);
+}
+
+void fastJetTree::branchTreeConstituents(TTree *t)
+{
+    b_constoffset = t->Branch("constoffset", &constoffset);
+    b_constidx = t->Branch("constidx", &constidx);
+}
+
+void fastJetTree::branchTreeParton(TTree *t)
+{
+    if (flatCapacity > 0) {
+        b_partonidx = branchFlat(t, "partonidx", "nJet", partonidx, flatCapacity);
+        b_partonid = branchFlat(t, "partonid", "nJet", partonid, flatCapacity);
+        b_partonoutidx = branchFlat(t, "partonoutidx", "nJet", partonoutidx, flatCapacity);
+        b_partondr = branchFlat(t, "partondr", "nJet", partondr, flatCapacity);
+        return;
+    }
+    b_partonidx = t->Branch("partonidx", &partonidx);
+    b_partonid = t->Branch("partonid", &partonid);
+    b_partonoutidx = t->Branch("partonoutidx", &partonoutidx);
+    b_partondr = t->Branch("partondr", &partondr);
+}
+
+void fastJetTree::branchTreeRho(TTree *t)
+{
+    b_rho = t->Branch("rho", &rho);
+    if (flatCapacity > 0) {
+        b_jetarea = branchFlat(t, "jetarea", "nJet", jetarea, flatCapacity);
+        return;
+    }
+    b_jetarea = t->Branch("jetarea", &jetarea);
+}
+
+void fastJetTree::branchTreeWTA(TTree *t)
+{
+    if (flatCapacity > 0) {
+        b_wtaeta = branchFlat(t, "wtaeta", "nJet", wtaeta, flatCapacity);
+        b_wtaphi = branchFlat(t, "wtaphi", "nJet", wtaphi, flatCapacity);
+        return;
+    }
+    b_wtaeta = t->Branch("wtaeta", &wtaeta);
+    b_wtaphi = t->Branch("wtaphi", &wtaphi);
+}
+
+void fastJetTree::branchTreeSubstructure(TTree *t)
+{
+    if (flatCapacity > 0) {
+        b_nconst = branchFlat(t, "nconst", "nJet", nconst, flatCapacity);
+        b_ptd = branchFlat(t, "ptd", "nJet", ptd, flatCapacity);
+        b_lambda05 = branchFlat(t, "lambda05", "nJet", lambda05, flatCapacity);
+        b_lambda10 = branchFlat(t, "lambda10", "nJet", lambda10, flatCapacity);
+        b_lambda20 = branchFlat(t, "lambda20", "nJet", lambda20, flatCapacity);
+        b_sdzg = branchFlat(t, "sdzg", "nJet", sdzg, flatCapacity);
+        b_sdrg = branchFlat(t, "sdrg", "nJet", sdrg, flatCapacity);
+        return;
+    }
+    b_nconst = t->Branch("nconst", &nconst);
+    b_ptd = t->Branch("ptd", &ptd);
+    b_lambda05 = t->Branch("lambda05", &lambda05);
+    b_lambda10 = t->Branch("lambda10", &lambda10);
+    b_lambda20 = t->Branch("lambda20", &lambda20);
+    b_sdzg = t->Branch("sdzg", &sdzg);
+    b_sdrg = t->Branch("sdrg", &sdrg);
+}
+
+void fastJetTree::branchTreeMatch(TTree *t)
+{
+    if (flatCapacity > 0) {
+        b_matchidx = branchFlat(t, "matchidx", "nJet", matchidx, flatCapacity);
+        b_matchdr = branchFlat(t, "matchdr", "nJet", matchdr, flatCapacity);
+        return;
+    }
+    b_matchidx = t->Branch("matchidx", &matchidx);
+    b_matchdr = t->Branch("matchdr", &matchdr);
+}
+
+/*
+ * the storageWriter versions of the branch functions write either a TTree or an RNTuple,
+ * the flat layout is used only for TTree
+ */
+void fastJetTree::branchTree(storageWriter& w)
+{
+    if (w.tree) {
+        branchTree(w.tree);
+        return;
+    }
+    w.branchScalar("nJet", &nJet);
+    w.branchVector("jetpt", jetpt);
+    w.branchVector("jeteta", jeteta);
+    w.branchVector("jetphi", jetphi);
+    w.branchVector("rawpt", rawpt);
+    w.branchVector("rawphi", rawphi);
+}
+
+void fastJetTree::branchTreeConstituents(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeConstituents(w.tree);
+        return;
+    }
+    w.branchVector("constoffset", constoffset);
+    w.branchVector("constidx", constidx);
+}
+
+void fastJetTree::branchTreeParton(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeParton(w.tree);
+        return;
+    }
+    w.branchVector("partonidx", partonidx);
+    w.branchVector("partonid", partonid);
+    w.branchVector("partonoutidx", partonoutidx);
+    w.branchVector("partondr", partondr);
+}
+
+void fastJetTree::branchTreeRho(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeRho(w.tree);
+        return;
+    }
+    w.branchScalar("rho", &rho);
+    w.branchVector("jetarea", jetarea);
+}
+
+void fastJetTree::branchTreeWTA(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeWTA(w.tree);
+        return;
+    }
+    w.branchVector("wtaeta", wtaeta);
+    w.branchVector("wtaphi", wtaphi);
+}
+
+void fastJetTree::branchTreeSubstructure(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeSubstructure(w.tree);
+        return;
+    }
+    w.branchVector("nconst", nconst);
+    w.branchVector("ptd", ptd);
+    w.branchVector("lambda05", lambda05);
+    w.branchVector("lambda10", lambda10);
+    w.branchVector("lambda20", lambda20);
+    w.branchVector("sdzg", sdzg);
+    w.branchVector("sdrg", sdrg);
+}
+
+void fastJetTree::branchTreeMatch(storageWriter& w)
+{
+    if (w.tree) {
+        branchTreeMatch(w.tree);
+        return;
+    }
+    w.branchVector("matchidx", matchidx);
+    w.branchVector("matchdr", matchdr);
 }
 
 void fastJetTree::clearEvent()
@@ -68,6 +426,135 @@ void fastJetTree::clearEvent()
     jetphi->clear();
     rawpt->clear();
     rawphi->clear();
+    if (constoffset) constoffset->clear();
+    if (constidx) constidx->clear();
+    if (partonidx) partonidx->clear();
+    if (partonid) partonid->clear();
+    if (partonoutidx) partonoutidx->clear();
+    if (partondr) partondr->clear();
+    rho = 0;
+    if (jetarea) jetarea->clear();
+    if (wtaeta) wtaeta->clear();
+    if (wtaphi) wtaphi->clear();
+    if (nconst) nconst->clear();
+    if (ptd) ptd->clear();
+    if (lambda05) lambda05->clear();
+    if (lambda10) lambda10->clear();
+    if (lambda20) lambda20->clear();
+    if (sdzg) sdzg->clear();
+    if (sdrg) sdrg->clear();
+    if (matchidx) matchidx->clear();
+    if (matchdr) matchdr->clear();
+}
+
+/*
+ * reserve space for "n" jets in the vectors which are in use
+ */
+void fastJetTree::reserve(int n)
+{
+    if (constoffset) constoffset->reserve(n+1);
+    if (flatCapacity > 0) {
+        if (n > flatCapacity) flatCapacity = n;
+        bindFlatLayout();
+        return;
+    }
+    jetpt->reserve(n);
+    jeteta->reserve(n);
+    jetphi->reserve(n);
+    rawpt->reserve(n);
+    rawphi->reserve(n);
+    if (partonidx) partonidx->reserve(n);
+    if (partonid) partonid->reserve(n);
+    if (partonoutidx) partonoutidx->reserve(n);
+    if (partondr) partondr->reserve(n);
+    if (jetarea) jetarea->reserve(n);
+    if (wtaeta) wtaeta->reserve(n);
+    if (wtaphi) wtaphi->reserve(n);
+    if (nconst) nconst->reserve(n);
+    if (ptd) ptd->reserve(n);
+    if (lambda05) lambda05->reserve(n);
+    if (lambda10) lambda10->reserve(n);
+    if (lambda20) lambda20->reserve(n);
+    if (sdzg) sdzg->reserve(n);
+    if (sdrg) sdrg->reserve(n);
+    if (matchidx) matchidx->reserve(n);
+    if (matchdr) matchdr->reserve(n);
+}
+
+/*
+ * the branches created by the next branchTree*() calls use the flat layout with space for "capacity" jets
+ */
+void fastJetTree::setFlatLayout(int capacity)
+{
+    flatCapacity = capacity;
+}
+
+/*
+ * the kinematics of the next entries are stored with truncated mantissas if "value" > 0
+ */
+void fastJetTree::setReducedPrecision(int value)
+{
+    reducedPrecision = value;
+}
+
+/*
+ * prepares the current entry for Fill() : converts it to the stored precision in place
+ * and points the flat branches to the current storage of the vectors, which moves if they grow beyond their capacity.
+ */
+void fastJetTree::encode()
+{
+    if (reducedPrecision > 0) {
+        truncateMantissa(jetpt, PRECISION::nBitsPt);
+        truncateMantissa(jeteta, PRECISION::nBitsEta);
+        truncateMantissa(jetphi, PRECISION::nBitsPhi);
+        truncateMantissa(rawpt, PRECISION::nBitsPt);
+        truncateMantissa(rawphi, PRECISION::nBitsPhi);
+        truncateMantissa(wtaeta, PRECISION::nBitsEta);
+        truncateMantissa(wtaphi, PRECISION::nBitsPhi);
+    }
+
+    if (flatCapacity > 0) {
+        if (nJet > flatCapacity) flatCapacity = nJet;
+        bindFlatLayout();
+    }
+}
+
+/*
+ * copies the arrays of an entry read with the flat layout into the vectors, nothing is done for the vector layout
+ */
+void fastJetTree::decode()
+{
+    flatBuffers.copy(nJet);
+}
+
+/*
+ * points the flat branches to the current storage of the vectors, returns true if any of them had moved
+ */
+bool fastJetTree::bindFlatLayout()
+{
+    bool moved = false;
+    moved |= bindFlat(b_jetpt, jetpt, flatCapacity);
+    moved |= bindFlat(b_jeteta, jeteta, flatCapacity);
+    moved |= bindFlat(b_jetphi, jetphi, flatCapacity);
+    moved |= bindFlat(b_rawpt, rawpt, flatCapacity);
+    moved |= bindFlat(b_rawphi, rawphi, flatCapacity);
+    moved |= bindFlat(b_partonidx, partonidx, flatCapacity);
+    moved |= bindFlat(b_partonid, partonid, flatCapacity);
+    moved |= bindFlat(b_partonoutidx, partonoutidx, flatCapacity);
+    moved |= bindFlat(b_partondr, partondr, flatCapacity);
+    moved |= bindFlat(b_jetarea, jetarea, flatCapacity);
+    moved |= bindFlat(b_wtaeta, wtaeta, flatCapacity);
+    moved |= bindFlat(b_wtaphi, wtaphi, flatCapacity);
+    moved |= bindFlat(b_nconst, nconst, flatCapacity);
+    moved |= bindFlat(b_ptd, ptd, flatCapacity);
+    moved |= bindFlat(b_lambda05, lambda05, flatCapacity);
+    moved |= bindFlat(b_lambda10, lambda10, flatCapacity);
+    moved |= bindFlat(b_lambda20, lambda20, flatCapacity);
+    moved |= bindFlat(b_sdzg, sdzg, flatCapacity);
+    moved |= bindFlat(b_sdrg, sdrg, flatCapacity);
+    moved |= bindFlat(b_matchidx, matchidx, flatCapacity);
+    moved |= bindFlat(b_matchdr, matchdr, flatCapacity);
+    return moved;
 }
 
 #endif /* FASTJETTREE_H_ */
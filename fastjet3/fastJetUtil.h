@@ -0,0 +1,635 @@
+/*
+ * utilities related to FastJet.
+ */
+
+#include "fastjet/ClusterSequence.hh"
+#include "fastjet/PseudoJet.hh"
+#include "fastjet/Error.hh"
+
+#include "fastJetTree.h"
+#include "../utilities/particleTree.h"
+#include "../utilities/physicsUtil.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef FASTJETUTIL_H_
+#define FASTJETUTIL_H_
+
+struct jetLoopBuffers;
+
+int getStrategyIndex(std::string strategyName);
+fastjet::Strategy chooseStrategy(int nParticles);
+bool isNlnNAvailable();
+void fillSortedInclusiveJets(const fastjet::ClusterSequence& clustSeq, double ptMin, std::vector<fastjet::PseudoJet>& jets);
+void fillConstituents(const fastjet::PseudoJet& jet, std::vector<fastjet::PseudoJet>& constituents);
+fastjet::PseudoJet getWTAAxis(const fastjet::PseudoJet& jet);
+double getPtD(const std::vector<fastjet::PseudoJet>& constituents);
+double getAngularity(const fastjet::PseudoJet& jet, const std::vector<fastjet::PseudoJet>& constituents, double jetR,
+                     double kappa, double beta);
+void getSoftDropZgRg(const std::vector<fastjet::PseudoJet>& constituents, double jetR, double zcut, double beta,
+                     double& zg, double& rg);
+void fillSubstructure(fastJetTree& fjt, const fastjet::PseudoJet& jet, const std::vector<fastjet::PseudoJet>& constituents,
+                      double jetR, double zcut, double beta);
+void copyLastSubstructure(fastJetTree& fjtDst, const fastJetTree& fjtSrc);
+void matchJets(const std::vector<fastjet::PseudoJet>& jets1, const std::vector<fastjet::PseudoJet>& jets2, double maxDR,
+               std::vector<int>& matchIdx1, std::vector<float>& matchDR1, std::vector<int>& matchIdx2, std::vector<float>& matchDR2,
+               jetLoopBuffers& buffers);
+
+namespace FASTJETUTIL {
+
+enum STRATEGIES {
+    kBest,        // FastJet's own choice
+    kN2Plain,
+    kN2Tiled,
+    kNlnN,        // requires FastJet built with CGAL
+    kAuto,        // one of N2Plain, N2Tiled, NlnN chosen per event from the multiplicity
+    kN_STRATEGIES
+};
+const std::string STRATEGYNAMES[kN_STRATEGIES] = {
+        "best",
+        "N2Plain",
+        "N2Tiled",
+        "NlnN",
+        "auto"
+    };
+
+const fastjet::Strategy FJSTRATEGIES[kN_STRATEGIES] = {
+        fastjet::Best,
+        fastjet::N2Plain,
+        fastjet::N2Tiled,
+        fastjet::NlnN,
+        fastjet::Best
+    };
+
+/*
+ * multiplicity thresholds for strategy "auto"
+ * N < maxN2Plain : N2Plain, maxN2Plain <= N < maxN2Tiled : N2Tiled, N >= maxN2Tiled : NlnN
+ * N2Tiled is used instead of NlnN if FastJet is built without CGAL
+ * the values can be checked with benchmarkClusterJets
+ */
+const int maxN2Plain = 50;
+const int maxN2Tiled = 30000;
+}
+
+/*
+ * jet definitions which differ only in clustering strategy.
+ * For strategy "auto" the jet definition is chosen per event from the multiplicity.
+ * "auto" never chooses NlnN if it is not available.
+ */
+class jetDefinitionSelector {
+public :
+    jetDefinitionSelector(const fastjet::JetDefinition& jetDefn, int iStrategy);
+    ~jetDefinitionSelector(){};
+
+    const fastjet::JetDefinition& get(int nParticles) const;
+
+    int iStrategy;
+    bool autoNlnN;                                  // whether "auto" can choose NlnN
+    std::vector<fastjet::JetDefinition> jetDefns;   // one per strategy in FASTJETUTIL::STRATEGIES
+};
+
+jetDefinitionSelector::jetDefinitionSelector(const fastjet::JetDefinition& jetDefn, int iStrategy_)
+{
+    iStrategy = iStrategy_;
+    for (int i = 0; i < FASTJETUTIL::kN_STRATEGIES; ++i) {
+        jetDefns.push_back(fastjet::JetDefinition(jetDefn.jet_algorithm(), jetDefn.R(),
+                                                  jetDefn.recombination_scheme(), FASTJETUTIL::FJSTRATEGIES[i]));
+    }
+
+    autoNlnN = false;
+    if (iStrategy == FASTJETUTIL::kAuto) {
+        autoNlnN = isNlnNAvailable();
+        if (!autoNlnN) {
+            std::cout << "Strategy NlnN is not available (FastJet without CGAL), auto uses N2Tiled instead." << std::endl;
+        }
+    }
+}
+
+const fastjet::JetDefinition& jetDefinitionSelector::get(int nParticles) const
+{
+    if (iStrategy != FASTJETUTIL::kAuto) return jetDefns[iStrategy];
+
+    fastjet::Strategy strategy = chooseStrategy(nParticles);
+    if (strategy == fastjet::N2Plain)      return jetDefns[FASTJETUTIL::kN2Plain];
+    else if (strategy == fastjet::N2Tiled) return jetDefns[FASTJETUTIL::kN2Tiled];
+    else if (!autoNlnN)                    return jetDefns[FASTJETUTIL::kN2Tiled];
+    else                                   return jetDefns[FASTJETUTIL::kNlnN];
+}
+
+/*
+ * jets sorted into eta-phi cells whose size is at least maxDR.
+ * The jets within maxDR of a direction are in the 3x3 cells around the cell of that direction,
+ * so the closest jet is found without looping over all jets.
+ */
+class etaPhiGrid {
+public :
+    etaPhiGrid(double maxDR = 1, double maxAbsEta = 6);
+    ~etaPhiGrid(){};
+
+    void setMaxDR(double maxDR, double maxAbsEta = 6);
+    void fill(const std::vector<fastjet::PseudoJet>& jets);
+    int getClosest(double eta, double phi, double& dR) const;
+
+private :
+    int getEtaBin(double eta) const;
+    int getPhiBin(double phi) const;
+
+    double maxDR;
+    double etaMin;
+    double cellEta;
+    double cellPhi;
+    int nEta;
+    int nPhi;
+
+    // jets in cell c are cellJets[cellOffsets[c]], ..., cellJets[cellOffsets[c+1]-1]
+    std::vector<int> cellOffsets;
+    std::vector<int> cellFill;
+    std::vector<int> cellJets;
+    std::vector<int> jetCells;
+    std::vector<double> etas;
+    std::vector<double> phis;
+};
+
+etaPhiGrid::etaPhiGrid(double maxDR_, double maxAbsEta)
+{
+    setMaxDR(maxDR_, maxAbsEta);
+}
+
+/*
+ * the cell arrays keep their capacity, so a grid can be reused with another maxDR
+ */
+void etaPhiGrid::setMaxDR(double maxDR_, double maxAbsEta)
+{
+    maxDR = maxDR_;
+    etaMin = -maxAbsEta;
+    nEta = std::max(1, (int)(2 * maxAbsEta / maxDR));
+    cellEta = 2 * maxAbsEta / nEta;
+    nPhi = std::max(1, (int)(2 * M_PI / maxDR));
+    cellPhi = 2 * M_PI / nPhi;
+}
+
+/*
+ * jets outside |eta| < maxAbsEta are put in the first or last eta cell
+ */
+int etaPhiGrid::getEtaBin(double eta) const
+{
+    int iEta = (int)std::floor((eta - etaMin) / cellEta);
+    return std::min(std::max(iEta, 0), nEta - 1);
+}
+
+int etaPhiGrid::getPhiBin(double phi) const
+{
+    int iPhi = (int)std::floor((correctPhiRange(phi) + M_PI) / cellPhi);
+    return std::min(std::max(iPhi, 0), nPhi - 1);
+}
+
+void etaPhiGrid::fill(const std::vector<fastjet::PseudoJet>& jets)
+{
+    int nJets = jets.size();
+    int nCells = nEta * nPhi;
+
+    etas.resize(nJets);
+    phis.resize(nJets);
+    jetCells.resize(nJets);
+    cellJets.resize(nJets);
+    cellOffsets.assign(nCells + 1, 0);
+
+    // counting sort of the jets into cells
+    for (int i = 0; i < nJets; ++i) {
+        etas[i] = jets[i].eta();
+        phis[i] = jets[i].phi_std();
+        jetCells[i] = getEtaBin(etas[i]) * nPhi + getPhiBin(phis[i]);
+        cellOffsets[jetCells[i] + 1]++;
+    }
+    for (int c = 0; c < nCells; ++c) {
+        cellOffsets[c + 1] += cellOffsets[c];
+    }
+    cellFill.assign(cellOffsets.begin(), cellOffsets.end() - 1);
+    for (int i = 0; i < nJets; ++i) {
+        cellJets[cellFill[jetCells[i]]++] = i;
+    }
+}
+
+/*
+ * returns the index of the closest jet within maxDR of (eta, phi), -1 if there is none
+ */
+int etaPhiGrid::getClosest(double eta, double phi, double& dR) const
+{
+    int iEta = getEtaBin(eta);
+    int iPhi = getPhiBin(phi);
+
+    int iClosest = -1;
+    double dR2Min = maxDR * maxDR;
+
+    int nPhiNeighbors = std::min(nPhi, 3);
+    for (int dEta = -1; dEta <= 1; ++dEta) {
+        int iEtaCell = iEta + dEta;
+        if (iEtaCell < 0 || iEtaCell >= nEta) continue;
+
+        for (int dPhi = 0; dPhi < nPhiNeighbors; ++dPhi) {
+            int iPhiCell = (iPhi + dPhi - (nPhiNeighbors / 2) + nPhi) % nPhi;
+            int c = iEtaCell * nPhi + iPhiCell;
+
+            for (int k = cellOffsets[c]; k < cellOffsets[c + 1]; ++k) {
+                int j = cellJets[k];
+                double dR2 = getDR2(eta, phi, etas[j], phis[j]);
+                if (dR2 < dR2Min) {
+                    dR2Min = dR2;
+                    iClosest = j;
+                }
+            }
+        }
+    }
+
+    dR = (iClosest >= 0) ? std::sqrt(dR2Min) : -1;
+    return iClosest;
+}
+
+/*
+ * buffers reused in every event of a jet loop. They keep their capacity between events, so that the steady state
+ * of the loop does not allocate memory outside of FastJet. There should be one object per thread.
+ */
+struct jetLoopBuffers {
+    std::vector<fastjet::PseudoJet> jets;           // inclusive jets sorted by pt
+    std::vector<fastjet::PseudoJet> constituents;   // constituents of a single jet
+
+    // used by matchJets()
+    etaPhiGrid grid1;
+    etaPhiGrid grid2;
+    std::vector<int> closest1;
+    std::vector<int> closest2;
+    std::vector<double> dR1;
+};
+
+/*
+ * converts the massless particles of a particleTree event into fastjet::PseudoJet objects in batch.
+ * The selection (|eta| < maxAbsEta and optionally charge != 0) is fused into the first pass which compacts the
+ * selected (pt, eta, phi) into contiguous arrays. The second pass computes (px, py, pz, E) over these arrays
+ * without branches. It is a scalar loop with the default flags : the math calls are not vectorized
+ * without -ffast-math, which is not used for this code.
+ * sinh(eta) and cosh(eta) are obtained from a single exp(eta). E = |p| as particles are massless.
+ *
+ * The scratch arrays are members of the object and keep their capacity between events,
+ * the same object should be reused for all events.
+ */
+class pseudoJetConverter {
+public :
+    pseudoJetConverter(){};
+    ~pseudoJetConverter(){};
+
+    int fill(particleTree& particles, std::vector<fastjet::PseudoJet>& fjParticles, bool onlyCharged,
+             int indexOffset = 0, double maxAbsEta = 5);
+
+private :
+    void resizeScratch(int n);
+
+    std::vector<int> indices;
+    std::vector<double> pt;
+    std::vector<double> eta;
+    std::vector<double> phi;
+    std::vector<double> px;
+    std::vector<double> py;
+    std::vector<double> pz;
+    std::vector<double> e;
+};
+
+void pseudoJetConverter::resizeScratch(int n)
+{
+    if ((int)indices.size() >= n) return;
+
+    indices.resize(n);
+    pt.resize(n);
+    eta.resize(n);
+    phi.resize(n);
+    px.resize(n);
+    py.resize(n);
+    pz.resize(n);
+    e.resize(n);
+}
+
+/*
+ * appends the selected particles to "fjParticles".
+ * user_index of a PseudoJet is set to (index of the particle in the event) + indexOffset.
+ * returns the number of appended particles.
+ */
+int pseudoJetConverter::fill(particleTree& particles, std::vector<fastjet::PseudoJet>& fjParticles, bool onlyCharged,
+                             int indexOffset, double maxAbsEta)
+{
+    int n = particles.n;
+    resizeScratch(n);
+
+    const float* ptIn = particles.pt->data();
+    const float* etaIn = particles.eta->data();
+    const float* phiIn = particles.phi->data();
+    const float* chgIn = particles.chg->data();
+
+    // pass 1 : selection and compaction
+    int nSel = 0;
+    for (int i = 0; i < n; ++i) {
+        bool pass = (std::fabs(etaIn[i]) <= maxAbsEta) && (!onlyCharged || chgIn[i] != 0);
+
+        indices[nSel] = i;
+        pt[nSel] = ptIn[i];
+        eta[nSel] = etaIn[i];
+        phi[nSel] = phiIn[i];
+        nSel += pass;
+    }
+
+    // pass 2 : kinematics
+    for (int i = 0; i < nSel; ++i) {
+        double expEta = std::exp(eta[i]);
+        double expMinusEta = 1. / expEta;
+
+        px[i] = pt[i] * std::cos(phi[i]);
+        py[i] = pt[i] * std::sin(phi[i]);
+        pz[i] = pt[i] * 0.5 * (expEta - expMinusEta);
+        e[i] = pt[i] * 0.5 * (expEta + expMinusEta);
+    }
+
+    // pass 3 : fill the PseudoJet buffer in place
+    int nOld = fjParticles.size();
+    fjParticles.resize(nOld + nSel);
+    for (int i = 0; i < nSel; ++i) {
+        fjParticles[nOld + i].reset_momentum(px[i], py[i], pz[i], e[i]);
+        fjParticles[nOld + i].set_user_index(indices[i] + indexOffset);
+    }
+
+    return nSel;
+}
+
+/*
+ * returns the index of a strategy in FASTJETUTIL::STRATEGIES, -1 if not found
+ */
+int getStrategyIndex(std::string strategyName)
+{
+    for (int i = 0; i < FASTJETUTIL::kN_STRATEGIES; ++i) {
+        if (strategyName == FASTJETUTIL::STRATEGYNAMES[i]) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * clustering strategy for an event with "nParticles" input particles
+ */
+fastjet::Strategy chooseStrategy(int nParticles)
+{
+    if (nParticles < FASTJETUTIL::maxN2Plain)       return fastjet::N2Plain;
+    else if (nParticles < FASTJETUTIL::maxN2Tiled)  return fastjet::N2Tiled;
+    else                                            return fastjet::NlnN;
+}
+
+/*
+ * NlnN requires FastJet built with CGAL, otherwise the clustering throws fastjet::Error.
+ * The availability is checked once with a trial clustering of a few particles.
+ */
+bool isNlnNAvailable()
+{
+    static int available = -1;
+    if (available < 0) {
+        std::vector<fastjet::PseudoJet> particles;
+        for (int i = 0; i < 3; ++i) {
+            particles.push_back(fastjet::PtYPhiM(1, 0.5 * i, i));
+        }
+        try {
+            fastjet::ClusterSequence clustSeq(particles, fastjet::JetDefinition(fastjet::antikt_algorithm, 0.4,
+                                                                                fastjet::E_scheme, fastjet::NlnN));
+            available = 1;
+        }
+        catch (fastjet::Error&) {
+            available = 0;
+        }
+    }
+    return (available == 1);
+}
+
+/*
+ * same as sorted_by_pt(clustSeq.inclusive_jets(ptMin)), but the jets are written into an existing vector
+ * and sorted in place. Inclusive jets are the ones which are merged with the beam in the clustering history.
+ */
+void fillSortedInclusiveJets(const fastjet::ClusterSequence& clustSeq, double ptMin, std::vector<fastjet::PseudoJet>& jets)
+{
+    jets.clear();
+
+    double ptMin2 = ptMin * ptMin;
+    const std::vector<fastjet::ClusterSequence::history_element>& history = clustSeq.history();
+    const std::vector<fastjet::PseudoJet>& jetsAll = clustSeq.jets();
+
+    int nHistory = history.size();
+    for (int i = 0; i < nHistory; ++i) {
+        if (history[i].parent2 != fastjet::ClusterSequence::BeamJet) continue;
+
+        const fastjet::PseudoJet& jet = jetsAll[history[history[i].parent1].jetp_index];
+        if (jet.perp2() >= ptMin2) {
+            jets.push_back(jet);
+        }
+    }
+
+    std::sort(jets.begin(), jets.end(),
+              [](const fastjet::PseudoJet& jet1, const fastjet::PseudoJet& jet2) { return jet1.kt2() > jet2.kt2(); });
+}
+
+/*
+ * same as jet.constituents(), but the constituents are written into an existing vector
+ */
+void fillConstituents(const fastjet::PseudoJet& jet, std::vector<fastjet::PseudoJet>& constituents)
+{
+    constituents.clear();
+    jet.validated_cs()->add_constituents(jet, constituents);
+}
+
+/*
+ * winner-take-all axis of a jet : the constituents of the jet are reclustered with Cambridge/Aachen
+ * using WTA_pt_scheme into a single jet. Only the jet constituents are clustered, not the whole event.
+ * The returned PseudoJet has the direction of the WTA axis and pt of the jet.
+ */
+fastjet::PseudoJet getWTAAxis(const fastjet::PseudoJet& jet)
+{
+    static const fastjet::JetDefinition jetDefnWTA(fastjet::cambridge_algorithm, fastjet::JetDefinition::max_allowable_R,
+                                                   fastjet::WTA_pt_scheme);
+
+    fastjet::ClusterSequence clustSeq(jet.constituents(), jetDefnWTA);
+    std::vector<fastjet::PseudoJet> jetsWTA = clustSeq.exclusive_jets(1);
+
+    // do not keep a reference to the local cluster sequence
+    return fastjet::PseudoJet(jetsWTA[0].px(), jetsWTA[0].py(), jetsWTA[0].pz(), jetsWTA[0].E());
+}
+
+/*
+ * pTD = sqrt(sum pt_i^2) / sum pt_i over the jet constituents
+ */
+double getPtD(const std::vector<fastjet::PseudoJet>& constituents)
+{
+    double sumPt = 0;
+    double sumPt2 = 0;
+
+    int n = constituents.size();
+    for (int i = 0; i < n; ++i) {
+        double pt = constituents[i].pt();
+        sumPt += pt;
+        sumPt2 += pt * pt;
+    }
+
+    return (sumPt > 0) ? std::sqrt(sumPt2) / sumPt : 0;
+}
+
+/*
+ * generalized angularity lambda^kappa_beta = sum z_i^kappa (dR_i / jetR)^beta
+ * z_i = pt_i / sum pt_j, dR_i is the distance between the constituent and the jet axis
+ */
+double getAngularity(const fastjet::PseudoJet& jet, const std::vector<fastjet::PseudoJet>& constituents, double jetR,
+                     double kappa, double beta)
+{
+    double sumPt = 0;
+
+    int n = constituents.size();
+    for (int i = 0; i < n; ++i) {
+        sumPt += constituents[i].pt();
+    }
+    if (sumPt <= 0) return 0;
+
+    double res = 0;
+    for (int i = 0; i < n; ++i) {
+        double z = constituents[i].pt() / sumPt;
+        double dR = jet.delta_R(constituents[i]);
+        res += std::pow(z, kappa) * std::pow(dR / jetR, beta);
+    }
+
+    return res;
+}
+
+/*
+ * soft drop grooming : the constituents are reclustered with Cambridge/Aachen and the softer branch is dropped
+ * until a splitting satisfies min(pt1, pt2) / (pt1 + pt2) > zcut * (dR12 / jetR)^beta
+ * zg and rg are the momentum fraction and the distance of the two branches for that splitting.
+ * zg = rg = -1 if no splitting satisfies the condition.
+ */
+void getSoftDropZgRg(const std::vector<fastjet::PseudoJet>& constituents, double jetR, double zcut, double beta,
+                     double& zg, double& rg)
+{
+    static const fastjet::JetDefinition jetDefnCA(fastjet::cambridge_algorithm, fastjet::JetDefinition::max_allowable_R);
+
+    zg = -1;
+    rg = -1;
+    if (constituents.size() < 2) return;
+
+    fastjet::ClusterSequence clustSeq(constituents, jetDefnCA);
+    std::vector<fastjet::PseudoJet> jetsCA = clustSeq.exclusive_jets(1);
+
+    fastjet::PseudoJet jet = jetsCA[0];
+    fastjet::PseudoJet parent1;
+    fastjet::PseudoJet parent2;
+    while (jet.has_parents(parent1, parent2)) {
+
+        double pt1 = parent1.pt();
+        double pt2 = parent2.pt();
+        if (pt1 < pt2) {
+            std::swap(parent1, parent2);
+            std::swap(pt1, pt2);
+        }
+
+        double z = pt2 / (pt1 + pt2);
+        double dR = parent1.delta_R(parent2);
+        if (z > zcut * std::pow(dR / jetR, beta)) {
+            zg = z;
+            rg = dR;
+            return;
+        }
+
+        // follow the harder branch
+        jet = parent1;
+    }
+}
+
+/*
+ * fills the substructure branches of fastJetTree for a single jet
+ * angularities are calculated for kappa = 1 and beta = 0.5, 1, 2
+ */
+void fillSubstructure(fastJetTree& fjt, const fastjet::PseudoJet& jet, const std::vector<fastjet::PseudoJet>& constituents,
+                      double jetR, double zcut, double beta)
+{
+    fjt.nconst->push_back(constituents.size());
+    fjt.ptd->push_back(getPtD(constituents));
+    fjt.lambda05->push_back(getAngularity(jet, constituents, jetR, 1, 0.5));
+    fjt.lambda10->push_back(getAngularity(jet, constituents, jetR, 1, 1));
+    fjt.lambda20->push_back(getAngularity(jet, constituents, jetR, 1, 2));
+
+    double zg = -1;
+    double rg = -1;
+    getSoftDropZgRg(constituents, jetR, zcut, beta, zg, rg);
+    fjt.sdzg->push_back(zg);
+    fjt.sdrg->push_back(rg);
+}
+
+/*
+ * appends the substructure of the last jet in "fjtSrc" to "fjtDst"
+ * used when the same jet is written to several trees, ex. with different smearing
+ */
+void copyLastSubstructure(fastJetTree& fjtDst, const fastJetTree& fjtSrc)
+{
+    fjtDst.nconst->push_back(fjtSrc.nconst->back());
+    fjtDst.ptd->push_back(fjtSrc.ptd->back());
+    fjtDst.lambda05->push_back(fjtSrc.lambda05->back());
+    fjtDst.lambda10->push_back(fjtSrc.lambda10->back());
+    fjtDst.lambda20->push_back(fjtSrc.lambda20->back());
+    fjtDst.sdzg->push_back(fjtSrc.sdzg->back());
+    fjtDst.sdrg->push_back(fjtSrc.sdrg->back());
+}
+
+/*
+ * bijective matching of two jet collections : jet i in jets1 and jet j in jets2 are matched
+ * if j is the closest jet to i in jets2 and i is the closest jet to j in jets1, with dR < maxDR.
+ * The closest jets are found using etaPhiGrid.
+ * matchIdx1[i] is the index of the matched jet in jets2, -1 if jet i is not matched. Same for matchIdx2.
+ * The output vectors are overwritten. The grids and the temporary arrays are taken from buffers.
+ */
+void matchJets(const std::vector<fastjet::PseudoJet>& jets1, const std::vector<fastjet::PseudoJet>& jets2, double maxDR,
+               std::vector<int>& matchIdx1, std::vector<float>& matchDR1, std::vector<int>& matchIdx2, std::vector<float>& matchDR2,
+               jetLoopBuffers& buffers)
+{
+    int nJets1 = jets1.size();
+    int nJets2 = jets2.size();
+
+    etaPhiGrid& grid1 = buffers.grid1;
+    etaPhiGrid& grid2 = buffers.grid2;
+    grid1.setMaxDR(maxDR);
+    grid2.setMaxDR(maxDR);
+    grid1.fill(jets1);
+    grid2.fill(jets2);
+
+    std::vector<int>& closest1 = buffers.closest1;
+    std::vector<int>& closest2 = buffers.closest2;
+    std::vector<double>& dR1 = buffers.dR1;
+    closest1.resize(nJets1);
+    closest2.resize(nJets2);
+    dR1.resize(nJets1);
+    for (int i = 0; i < nJets1; ++i) {
+        closest1[i] = grid2.getClosest(jets1[i].eta(), jets1[i].phi_std(), dR1[i]);
+    }
+    double dRTmp = 0;
+    for (int j = 0; j < nJets2; ++j) {
+        closest2[j] = grid1.getClosest(jets2[j].eta(), jets2[j].phi_std(), dRTmp);
+    }
+
+    matchIdx1.assign(nJets1, -1);
+    matchDR1.assign(nJets1, -1);
+    matchIdx2.assign(nJets2, -1);
+    matchDR2.assign(nJets2, -1);
+    for (int i = 0; i < nJets1; ++i) {
+        int j = closest1[i];
+        if (j >= 0 && closest2[j] == i) {
+            matchIdx1[i] = j;
+            matchDR1[i] = dR1[i];
+            matchIdx2[j] = i;
+            matchDR2[j] = dR1[i];
+        }
+    }
+}
+
+#endif /* FASTJETUTIL_H_ */
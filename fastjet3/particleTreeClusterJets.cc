@@ -8,9 +8,14 @@
 #include "TLorentzVector.h"
 
 #include "fastJetTree.h"
+#include "fastJetUtil.h"
 #include "../utilities/physicsUtil.h"
 #include "../utilities/systemUtil.h"
 #include "../utilities/particleTree.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/treeReadUtil.h"
+#include "../utilities/allocCounter.h"
+#include "../utilities/ArgumentParser.h"
 
 #include "fastjet/ClusterSequence.hh"
 #include "fastjet/PseudoJet.hh"
@@ -20,6 +25,8 @@
 #include <string>
 #include <vector>
 
+std::vector<std::string> argOptions;
+
 // types of particles to be used in jet clustering
 enum JETTYPES {
     kFinal,         // final state particles (after hadronization)
@@ -50,6 +57,58 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
     std::cout << "jetphiCSN = " << jetphiCSN.c_str() << std::endl;
     std::cout << "##### Parameters - END #####" << std::endl;
 
+    // substructure observables : constituent count, pTD, angularities and soft drop zg, Rg
+    int writeSubstructure = (ArgumentParser::ParseOptionInputSingle("--writeSubstructure", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--writeSubstructure", argOptions).c_str()) : 0;
+    double sdZcut = (ArgumentParser::ParseOptionInputSingle("--sdZcut", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--sdZcut", argOptions).c_str()) : 0.1;
+    double sdBeta = (ArgumentParser::ParseOptionInputSingle("--sdBeta", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--sdBeta", argOptions).c_str()) : 0;
+
+    // layout of the output trees : 0 for vector branches, otherwise C arrays with space for this many entries
+    int flatLayout = (ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).c_str()) : 0;
+
+    // jet kinematics with truncated mantissas if > 0, see utilities/precisionUtil.h
+    int reducedPrecision = (ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).c_str()) : 0;
+
+    // backend of the output jets : TTree or RNTuple, the backend of the input is detected
+    std::string storage = (ArgumentParser::ParseOptionInputSingle("--storage", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--storage", argOptions) : STORAGE::BACKENDNAMES[STORAGE::kTTree];
+
+    // clustering strategy, "auto" chooses the strategy per event from the number of input particles
+    std::string strategy = (ArgumentParser::ParseOptionInputSingle("--strategy", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--strategy", argOptions) : FASTJETUTIL::STRATEGYNAMES[FASTJETUTIL::kBest];
+
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "writeSubstructure = " << writeSubstructure << std::endl;
+    std::cout << "sdZcut = " << sdZcut << std::endl;
+    std::cout << "sdBeta = " << sdBeta << std::endl;
+    std::cout << "flatLayout = " << flatLayout << std::endl;
+    std::cout << "reducedPrecision = " << reducedPrecision << std::endl;
+    std::cout << "storage = " << storage.c_str() << std::endl;
+    std::cout << "strategy = " << strategy.c_str() << std::endl;
+    readSetup.printOptions();
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    int iStrategy = getStrategyIndex(strategy);
+    if (iStrategy < 0) {
+        std::cout << "Strategy : " << strategy.c_str() << " is not recognized as a valid strategy. Exiting." << std::endl;
+        return;
+    }
+
+    int iStorage = getStorageBackendIndex(storage);
+    if (iStorage < 0) {
+        std::cout << "Storage : " << storage.c_str() << " is not recognized as a valid storage backend. Exiting." << std::endl;
+        return;
+    }
+
+    readSetup.init();
+
     // Set up the ROOT TFile and TTree.
     TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
 
@@ -57,9 +116,14 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
 
     particleTree particles;
 
-    TTree* treeParticles = 0;
-    treeParticles = (TTree*)inputFile->Get(treePath.c_str());
-    particles.setupTreeForReading(treeParticles);
+    storageReader readerParticles(inputFile, treePath);
+    if (!readerParticles.isValid()) {
+        std::cout << "Input particles : " << treePath.c_str() << " could not be read. Exiting." << std::endl;
+        return;
+    }
+    readerParticles.setActiveBranches({"n", "pt", "eta", "phi", "chg"});
+    particles.setupTreeForReading(readerParticles);
+    readSetup.add("particles", &readerParticles);
 
     TFile* outputFile = new TFile(outputFileName.c_str(), "UPDATE");
 
@@ -71,6 +135,7 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
     fastjet::JetDefinition* fjJetDefn = 0;
     fjJetDefn = new fastjet::JetDefinition(fastjet::antikt_algorithm, jetRadius);
     fjJetDefn->set_recombination_scheme((fastjet::RecombinationScheme)recombScheme);
+    jetDefinitionSelector fjJetDefnSelector(*fjJetDefn, iStrategy);
 
     std::string jetTreeName = Form("ak%djets", dR);
     std::string jetTreeTitle = Form("jets with R = %.1f", jetRadius);
@@ -117,68 +182,76 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
     std::cout << "jetTreeName = " << jetTreeName.c_str() << std::endl;
     std::cout << "jetTreeTitle = " << jetTreeTitle.c_str() << std::endl;
 
-    TTree* jetTree = new TTree(jetTreeName.c_str(), jetTreeTitle.c_str());
+    storageWriter jetWriter(outputFile, jetTreeName, jetTreeTitle, iStorage);
     fastJetTree fjt;
-    fjt.branchTree(jetTree);
+    fjt.setFlatLayout(flatLayout);
+    fjt.setReducedPrecision(reducedPrecision);
+    fjt.branchTree(jetWriter);
+    if (writeSubstructure > 0) {
+        fjt.branchTreeSubstructure(jetWriter);
+    }
 
     // Fastjet input
     std::vector<fastjet::PseudoJet> fjParticles;
+    pseudoJetConverter fjConverter;
+    // Fastjet output
+    jetLoopBuffers fjBuffers;
+    std::vector<fastjet::PseudoJet>& sortedJets = fjBuffers.jets;
+    std::vector<fastjet::PseudoJet>& jetConstituents = fjBuffers.constituents;
+
+    // allocations in the jet loop, counted only if compiled with -DALLOCCOUNTER
+    // the allocations inside FastJet (clustering, soft drop) are not counted
+    allocSection allocJetLoop;
+    unsigned long long nAllocLastEvent = 0;
+    unsigned long long nAllocTotal = 0;
 
     std::cout << "Clustering with " << fjJetDefn->description().c_str() << std::endl;
+    std::cout << "Clustering strategy : " << strategy.c_str() << std::endl;
 
-    TRandom3 rand1(12345);
-    TRandom3 rand2(6789);
+    // counter-based generators : the random numbers for a jet depend only on (seed, entry, jet index)
+    counterRNG rand1(12345);
+    counterRNG rand2(6789);
     int eventsAnalyzed = 0;
-    int nEvents = treeParticles->GetEntries();
+    int nEvents = readerParticles.getEntries();
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
 
         if (iEvent % 10000 == 0)  {
           std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
+          if (allocCounterEnabled()) {
+              std::cout << "allocations in the jet loop for the last event = " << nAllocLastEvent << std::endl;
+          }
         }
 
         fjt.clearEvent();
-        treeParticles->GetEntry(iEvent);
+        readerParticles.getEntry(iEvent);
+        particles.decode();
 
         eventsAnalyzed++;
 
+        allocJetLoop.start();
+
         // Reset Fastjet input
         fjParticles.resize(0);
 
-        for (int i = 0; i < particles.n; ++i) {
-
-            if (useChParticles) {
-                if ((*particles.chg)[i] == 0) continue;
-            }
-
-            // Only |eta| < 5
-            if (std::fabs((*particles.eta)[i]) > 5) continue;
-
-            TLorentzVector vec4;
-            vec4.SetPtEtaPhiM((*particles.pt)[i], (*particles.eta)[i], (*particles.phi)[i], 0);
-
-            // Store as input to Fastjet
-            fastjet::PseudoJet fjParticle(vec4.Px(),
-                    vec4.Py(),
-                    vec4.Pz(),
-                    vec4.E());
-
-            fjParticle.set_user_index(i);
-
-            fjParticles.push_back(fjParticle);
-        }
+        // Store as input to Fastjet, only |eta| < 5
+        fjConverter.fill(particles, fjParticles, useChParticles);
 
         // Run Fastjet algorithm
-        fastjet::ClusterSequence clustSeq(fjParticles, *fjJetDefn);
+        allocJetLoop.pause();
+        fastjet::ClusterSequence clustSeq(fjParticles, fjJetDefnSelector.get(fjParticles.size()));
+        allocJetLoop.resume();
 
         // Extract inclusive jets sorted by pT (note the minimum pT)
-        std::vector<fastjet::PseudoJet> inclusiveJets = clustSeq.inclusive_jets(minJetPt);
-        std::vector<fastjet::PseudoJet> sortedJets    = sorted_by_pt(inclusiveJets);
+        fillSortedInclusiveJets(clustSeq, minJetPt, sortedJets);
 
         int nSortedJets = sortedJets.size();
+        fjt.reserve(nSortedJets);
         for (int i = 0; i < nSortedJets; ++i) {
 
+            rand1.setCounter(iEvent, i);
+            rand2.setCounter(iEvent, i);
             double sf = smearJetPt ? getEnergySmearingFactor(rand1, sortedJets[i].pt(), csnPt[0], csnPt[1], csnPt[2]) : 1;
             double sPhi = smearJetPhi ? getAngleSmearing(rand2, sortedJets[i].pt(), csnPhi[0], csnPhi[1], csnPhi[2]) : 0;
 
@@ -188,15 +261,31 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
             fjt.rawphi->push_back(sortedJets[i].phi_std());
             fjt.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
             fjt.nJet++;
+
+            if (writeSubstructure > 0) {
+                fillConstituents(sortedJets[i], jetConstituents);
+                allocJetLoop.pause();
+                fillSubstructure(fjt, sortedJets[i], jetConstituents, jetRadius, sdZcut, sdBeta);
+                allocJetLoop.resume();
+            }
         }
 
-        jetTree->Fill();
+        nAllocLastEvent = allocJetLoop.count();
+        nAllocTotal += nAllocLastEvent;
+
+        fjt.encode();
+        jetWriter.fill();
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
+    if (allocCounterEnabled() && eventsAnalyzed > 0) {
+        std::cout << "allocations in the jet loop per event = " << (double)nAllocTotal / eventsAnalyzed << std::endl;
+    }
+    readSetup.printStats();
     std::cout<<"Closing the input file"<<std::endl;
     inputFile->Close();
 
+    jetWriter.close();
     outputFile->Write("", TObject::kOverwrite);
     std::cout<<"Closing the output file"<<std::endl;
     outputFile->Close();
@@ -206,35 +295,40 @@ void particleTreeClusterJets(std::string inputFileName, std::string outputFileNa
 
 int main(int argc, char* argv[]) {
 
-    if (argc == 9) {
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 9) {
         particleTreeClusterJets(argv[1], argv[2], argv[3], std::atoi(argv[4]), std::atoi(argv[5]), std::atoi(argv[6]), argv[7], argv[8]);
         return 0;
     }
-    else if (argc == 8) {
+    else if (nArgStr == 8) {
         particleTreeClusterJets(argv[1], argv[2], argv[3], std::atoi(argv[4]), std::atoi(argv[5]), std::atoi(argv[6]), argv[7]);
         return 0;
     }
-    else if (argc == 7) {
+    else if (nArgStr == 7) {
         particleTreeClusterJets(argv[1], argv[2], argv[3], std::atoi(argv[4]), std::atoi(argv[5]), std::atoi(argv[6]));
         return 0;
     }
-    else if (argc == 6) {
+    else if (nArgStr == 6) {
         particleTreeClusterJets(argv[1], argv[2], argv[3], std::atoi(argv[4]), std::atoi(argv[5]));
         return 0;
     }
-    else if (argc == 5) {
+    else if (nArgStr == 5) {
         particleTreeClusterJets(argv[1], argv[2], argv[3], std::atoi(argv[4]));
         return 0;
     }
-    else if (argc == 4) {
+    else if (nArgStr == 4) {
         particleTreeClusterJets(argv[1], argv[2], argv[3]);
         return 0;
     }
-    else if (argc == 3) {
+    else if (nArgStr == 3) {
         particleTreeClusterJets(argv[1], argv[2]);
         return 0;
     }
-    else if (argc == 2) {
+    else if (nArgStr == 2) {
         particleTreeClusterJets(argv[1]);
         return 0;
     }
@@ -242,6 +336,15 @@ int main(int argc, char* argv[]) {
         std::cout << "Usage : \n" <<
                 "./particleTreeClusterJets.exe <inputFileName> <outputFileName> <treePath> <jetRadius> <minJetPt> <jetType> <jetptCSN> <jetphiCSN>"
                 << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "writeSubstructure=<write nConst, pTD, angularities and soft drop zg, Rg of jets if > 0>" << std::endl;
+        std::cout << "sdZcut=<zcut of soft drop>" << std::endl;
+        std::cout << "sdBeta=<beta of soft drop>" << std::endl;
+        std::cout << "flatLayout=<write the jet trees with C arrays, ex. jetpt[nJet]/F, with this initial capacity if > 0>" << std::endl;
+        std::cout << "reducedPrecision=<write the jet kinematics with truncated mantissas if > 0>" << std::endl;
+        std::cout << "storage=<backend of the output jets : TTree or RNTuple>" << std::endl;
+        std::cout << "strategy=<clustering strategy : best, N2Plain, N2Tiled, NlnN or auto>" << std::endl;
+        treeReadSetup().printUsage();
         return 1;
     }
 }
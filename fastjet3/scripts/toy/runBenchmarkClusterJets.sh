@@ -0,0 +1,62 @@
+#!/bin/bash
+
+## generates thermal events with fixed multiplicity using sampleToyEvents and measures the clustering time
+## of each strategy for these events. Run from the fastjet3 directory after "make benchmarkClusterJets.exe".
+
+runCmd=""
+if [ ! -z ${MYRUN} ]; then
+  runCmd=${MYRUN}
+fi
+
+progPathToy="../toy/sampleToyEvents.exe"
+progPath="./benchmarkClusterJets.exe"
+
+mode=1
+nEvents=200
+maxEta=5
+meanPt=0.65
+minPt=0
+partTreeName="evtToy"
+rndSeedParticle=6789
+
+jetRadius=4
+strategies="N2Plain,N2Tiled,NlnN,best,auto"
+nRepeat=1
+
+## number of charged particles, neutral multiplicity is half of that
+multChs=(
+"10"
+"30"
+"100"
+"300"
+"1000"
+"3000"
+"10000"
+"30000"
+);
+
+outDir="../toy/benchmark"
+mkdir -p $outDir
+
+arrayIndices=${!multChs[*]}
+for i1 in $arrayIndices
+do
+    multCh=${multChs[i1]}
+
+    toyFile=$outDir"/sampleToyEvents_multCh"$multCh"_N"$nEvents".root"
+    toyFileLOG="${toyFile/.root/.log}"
+    $runCmd $progPathToy $mode $toyFile $nEvents --minMultCh=$multCh --maxMultCh=$multCh --maxEta=$maxEta --meanPt=$meanPt --minPt=$minPt --rndSeedParticle=$rndSeedParticle --particleTree=$partTreeName &> $toyFileLOG
+    echo "$runCmd $progPathToy $mode $toyFile $nEvents --minMultCh=$multCh --maxMultCh=$multCh --maxEta=$maxEta --meanPt=$meanPt --minPt=$minPt --rndSeedParticle=$rndSeedParticle --particleTree=$partTreeName &> $toyFileLOG"
+
+    outputFileLOG=$outDir"/benchmarkClusterJets_multCh"$multCh"_R"$jetRadius".log"
+    $runCmd $progPath $toyFile $partTreeName $jetRadius --strategies=$strategies --nRepeat=$nRepeat &> $outputFileLOG
+    echo "$runCmd $progPath $toyFile $partTreeName $jetRadius --strategies=$strategies --nRepeat=$nRepeat &> $outputFileLOG"
+done
+
+## summary table
+for i1 in $arrayIndices
+do
+    multCh=${multChs[i1]}
+    outputFileLOG=$outDir"/benchmarkClusterJets_multCh"$multCh"_R"$jetRadius".log"
+    grep -A 10 "time/event" $outputFileLOG | grep -v "running benchmarkClusterJets"
+done
@@ -12,12 +12,19 @@
 #include "TLorentzVector.h"
 
 #include "jetphoxTree.h"
+#include "../utilities/inputManifestUtil.h"
+#include "../utilities/treeReadUtil.h"
+#include "../utilities/inputFilesUtil.h"
+#include "../utilities/shardInfoUtil.h"
+#include "../utilities/ArgumentParser.h"
 
 #include <iostream>
 #include <iomanip>
 #include <string>
 #include <vector>
 
+std::vector<std::string> argOptions;
+
 void jetphoxAna(std::string inputFileName = "jetphox_ntuple.root", std::string outputFileName = "jetphoxAna_out.root");
 
 void jetphoxAna(std::string inputFileName, std::string outputFileName)
@@ -29,14 +36,56 @@ void jetphoxAna(std::string inputFileName, std::string outputFileName)
     std::cout << "outputFileName = " << outputFileName.c_str() << std::endl;
     std::cout << "##### Parameters - END #####" << std::endl;
 
-    // Set up the ROOT TFile and TTree.
-    TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    // write the histograms before normalization, used for the partial jobs of --nParallel
+    int partialOutput = (ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).c_str()) : 0;
+    // file with the merged histograms of the partial jobs, they are added instead of running the event loop
+    std::string mergePartials = (ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions) : "NULL";
+
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "partialOutput = " << partialOutput << std::endl;
+    std::cout << "mergePartials = " << mergePartials.c_str() << std::endl;
+    readSetup.printOptions();
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    readSetup.init();
+
+    // the input can be a list of files, it is read as a TChain
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+    std::cout << "number of input files = " << inputFiles.size() << std::endl;
 
     jetphoxTree jpt;
-    TTree *treeEvt = (TTree*)inputFile->Get("t2");
+
+    // the header is in the user info of the tree in each file, it is not available from the TChain.
+    // Each file is a run with its own cross section estimate, its events are weighted with it
+    // and the histograms are normalized with the total number of events.
+    std::vector<double> xsecs;
+    std::vector<double> nbEvts;
+    for (int i = 0; i < (int)inputFiles.size(); ++i) {
+        TFile* inputFile = TFile::Open(inputFiles[i].c_str(),"READ");
+        if (inputFile == 0 || inputFile->Get("t2") == 0) {
+            std::cout << "Tree t2 cannot be read from " << inputFiles[i].c_str() << ". Exiting." << std::endl;
+            return;
+        }
+        jpt.getHeaderInfo((TTree*)inputFile->Get("t2"));
+        xsecs.push_back(jpt.xsec);
+        nbEvts.push_back(jpt.nb_evt);
+        inputFile->Close();
+    }
+
+    TTree *treeEvt = openChain(inputFiles, "t2");
+    if (treeEvt == 0) {
+        std::cout << "Tree t2 cannot be read. Exiting." << std::endl;
+        return;
+    }
     jpt.setupTreeForReading(treeEvt);
-    jpt.getHeaderInfo(treeEvt);
-    double normFactor = jpt.xsec / jpt.nb_evt;
+    // only the photon kinematics and the event weight are used
+    applyManifest(treeEvt, {"ntrack", "px", "py", "pz", "pdf_weight"});
+    readSetup.add("t2", treeEvt);
 
     TFile* outputFile = new TFile(outputFileName.c_str(), "RECREATE");
 
@@ -66,8 +115,20 @@ void jetphoxAna(std::string inputFileName, std::string outputFileName)
     TH1D* h_phoEta = new TH1D("h_phoEta",Form(";%s;%s", strPhoEta.c_str(), strdSigmaPhoEta.c_str()), nBinsX_eta, axis_eta_min, axis_eta_max);
     TH1D* h_phoPhi = new TH1D("h_phoPhi",Form(";%s;%s", strPhoPhi.c_str(), strdSigmaPhoPhi.c_str()), nBinsX_phi, axis_phi_min, axis_phi_max);
 
+    // cross sections and numbers of events from the headers, it is summed when the partial outputs are merged
+    TH1D* h_shardInfo = newShardInfo();
+    if (mergePartials == "NULL") {
+        for (int i = 0; i < (int)inputFiles.size(); ++i) {
+            addShardInfo(h_shardInfo, xsecs[i], nbEvts[i]);
+        }
+    }
+
     int eventsAnalyzed = 0;
     int nEvents = treeEvt->GetEntries();
+    // the histograms of the partial jobs are added after the loop, the events are not read again
+    if (mergePartials != "NULL") {
+        nEvents = 0;
+    }
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
@@ -84,6 +145,8 @@ void jetphoxAna(std::string inputFileName, std::string outputFileName)
 
         double w = 1;
         w *= jpt.pdf_weight[0];
+        // cross section of the file of the current entry
+        w *= xsecs[treeEvt->GetTreeNumber()];
 
         double phoPt = jpt.pt(0);
         double phoEta = jpt.eta(0);
@@ -97,13 +160,33 @@ void jetphoxAna(std::string inputFileName, std::string outputFileName)
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
-    std::cout << "Closing the input file" << std::endl;
-    inputFile->Close();
+    readSetup.printStats();
+    std::cout << "Closing the input files" << std::endl;
+    delete treeEvt;
+
+    if (mergePartials != "NULL") {
+        addPartialHistograms(outputFile, mergePartials);
+    }
+
+    // the histograms are normalized after the partial outputs are merged
+    if (partialOutput > 0) {
+        std::cout << "saving partial histograms" << std::endl;
+        outputFile->Write("", TObject::kOverwrite);
+        std::cout << "Closing the output file" << std::endl;
+        outputFile->Close();
+        std::cout << "running jetphoxAna() - END" << std::endl;
+        return;
+    }
 
     // Save histogram on file and close file.
     std::cout << "saving histograms" << std::endl;
 
     // final histograms are differential cross section
+    double xsecTotal = 0;
+    double nbEvtTotal = 0;
+    getShardInfo(h_shardInfo, xsecTotal, nbEvtTotal);
+    std::cout << "number of events = " << nbEvtTotal << std::endl;
+    double normFactor = 1. / nbEvtTotal;
     h_phoPt->Scale(normFactor, "width");
     h_phoEta->Scale(normFactor, "width");
     h_phoPhi->Scale(normFactor, "width");
@@ -117,18 +200,47 @@ void jetphoxAna(std::string inputFileName, std::string outputFileName)
 
 int main(int argc, char* argv[]) {
 
-    if (argc == 3) {
-        jetphoxAna(argv[1], argv[2]);
-        return 0;
-    }
-    else if (argc == 2) {
-        jetphoxAna(argv[1]);
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    // number of input files processed concurrently, each file in a separate process
+    int nParallel = (ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).c_str()) : 1;
+
+    if (nArgStr == 3 || nArgStr == 2) {
+        std::string outputFileName = (nArgStr == 3) ? argStr.at(2) : "jetphoxAna_out.root";
+
+        std::vector<std::string> inputFiles = expandInputFiles(argStr.at(1));
+        if (nParallel <= 1 || inputFiles.size() <= 1) {
+            jetphoxAna(argStr.at(1), outputFileName);
+            return 0;
+        }
+
+        std::string mergedFileName = getPartialOutputName(outputFileName, -1);
+        bool jobsOK = runPartialJobs(inputFiles.size(), nParallel, outputFileName, mergedFileName, false,
+                [&](int iFile, std::string partialFileName) {
+                    setOption(argOptions, "--partialOutput", "1");
+                    jetphoxAna(inputFiles[iFile], partialFileName);
+                });
+        if (!jobsOK) {
+            std::cout << "Partial jobs failed. Exiting." << std::endl;
+            return 1;
+        }
+        setOption(argOptions, "--mergePartials", mergedFileName);
+        jetphoxAna(argStr.at(1), outputFileName);
+        std::remove(mergedFileName.c_str());
         return 0;
     }
     else {
         std::cout << "Usage : \n" <<
-                "./jetphoxAna.exe <inputFileName> <outputFileName>"
+                "./jetphoxAna.exe <inputFileName> <outputFileName> [options]"
                 << std::endl;
+        std::cout << "The input file name can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "--nParallel=<number of input files processed concurrently, the outputs are merged at the end>" << std::endl;
+        treeReadSetup().printUsage();
         return 1;
     }
 }
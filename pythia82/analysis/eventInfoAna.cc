@@ -17,13 +17,15 @@
 #include "TVirtualPad.h"
 #include "TApplication.h"
 
-// dictionary to read Pythia8::Event
-#include "../dictionary/dict4RootDct.cc"
 #include "../utils/pythiaUtil.h"
 #include "../../utilities/physicsUtil.h"
 #include "../../utilities/th1Util.h"
 #include "../../utilities/systemUtil.h"
 #include "../../utilities/ArgumentParser.h"
+#include "../../utilities/inputManifestUtil.h"
+#include "../../utilities/treeReadUtil.h"
+#include "../../utilities/inputFilesUtil.h"
+#include "../../utilities/eventIndexUtil.h"
 
 #include <iostream>
 #include <iomanip>
@@ -63,6 +65,19 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
     double qMax = (ArgumentParser::ParseOptionInputSingle("--qMax", argOptions).size() > 0) ?
             std::atof(ArgumentParser::ParseOptionInputSingle("--qMax", argOptions).c_str()) : -1;
 
+    // write the histograms before normalization, used for the partial jobs of --nParallel
+    int partialOutput = (ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).c_str()) : 0;
+    // file with the merged histograms of the partial jobs, they are added instead of running the event loop
+    std::string mergePartials = (ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions) : "NULL";
+
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    eventIndexSelection evtSelection;
+    evtSelection.parseOptions(argOptions);
+
     std::cout << "##### Optional Arguments #####" << std::endl;
     std::cout << "processCodes = { ";
     for (int i = 0; i < nProcessCodes; ++i) {
@@ -71,21 +86,40 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
     std::cout << "}" << std::endl;
     std::cout << "qMin = " << qMin << std::endl;
     std::cout << "qMax = " << qMax << std::endl;
+    std::cout << "partialOutput = " << partialOutput << std::endl;
+    std::cout << "mergePartials = " << mergePartials.c_str() << std::endl;
+    readSetup.printOptions();
+    evtSelection.printOptions();
     std::cout << "##### Optional Arguments - END #####" << std::endl;
 
-    TFile *inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    // trees read by this analysis, the particle level event is used only for the outgoing partons
+    inputManifest manifest("eventInfoAna");
+    manifest.add("evtInfo", {});
+    manifest.add("evt", {});
+    manifest.print();
+
+    readSetup.init();
+
+    // the input can be a list of files, it is read as TChains
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+    std::cout << "number of input files = " << inputFiles.size() << std::endl;
+
     Pythia8::Event *event = 0;
-    TTree *treeEvt = (TTree*)inputFile->Get("evt");
+    TTree *treeEvt = getTreeInManifest(inputFiles, "evt", "evt", manifest);
     treeEvt->SetBranchAddress("event", &event);
 
-    Pythia8::Event *eventParton = 0;
-    TTree* treeEvtParton = (TTree*)inputFile->Get("evtParton");
-    treeEvtParton->SetBranchAddress("event", &eventParton);
-
     Pythia8::Info *info = 0;
-    TTree* treeEvtInfo = (TTree*)inputFile->Get("evtInfo");
+    TTree* treeEvtInfo = getTreeInManifest(inputFiles, "evtInfo", "evtInfo", manifest);
     treeEvtInfo->SetBranchAddress("info", &info);
 
+    readSetup.add("evt", treeEvt);
+    readSetup.add("evtInfo", treeEvtInfo);
+
+    lazyInput inputEvt;
+    inputEvt.init("evt", treeEvt);
+    lazyInput inputEvtInfo;
+    inputEvtInfo.init("evtInfo", treeEvtInfo);
+
     TFile* outputFile = new TFile(outputFileName.c_str(), "RECREATE");
 
     TH1::SetDefaultSumw2();
@@ -150,6 +184,14 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
 
     int eventsAnalyzed = 0;
     int nEvents = treeEvt->GetEntries();
+    // the histograms of the partial jobs are added after the loop, the events are not read again
+    if (mergePartials != "NULL") {
+        nEvents = 0;
+    }
+    else if (!evtSelection.init(nEvents)) {
+        std::cout << "Event index cannot be applied. Exiting." << std::endl;
+        return;
+    }
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
@@ -158,10 +200,13 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
           std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
         }
 
-        treeEvt->GetEntry(iEvent);
-        treeEvtParton->GetEntry(iEvent);
-        treeEvtInfo->GetEntry(iEvent);
+        // events which do not pass the selection on the event index are not read
+        if (!evtSelection.passed(iEvent)) continue;
 
+        inputEvt.setEntry(iEvent);
+        inputEvtInfo.setEntry(iEvent);
+
+        inputEvtInfo.load();
         bool passedProcess = (nProcessCodes == 0);
         for (int i = 0; i < nProcessCodes; ++i) {
             if (processCodes[i] == -1 ||
@@ -214,6 +259,7 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
                 incomingPartons[i].idAbs() == 5)  h2_pdf_x[kcbQ]->Fill(x, scalePDF*pdf);
         }
 
+        inputEvt.load();
         // outgoing particles of the hardest subprocess are at index 5 and 6
         std::vector<int> indicesOutgoing = {5, 6};
         int nOutGoing = indicesOutgoing.size();
@@ -240,8 +286,26 @@ void eventInfoAna(std::string inputFileName, std::string outputFileName)
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
-    std::cout << "Closing the input file" << std::endl;
-    inputFile->Close();
+    inputEvt.printStats();
+    inputEvtInfo.printStats();
+    readSetup.printStats();
+    std::cout << "Closing the input files" << std::endl;
+    delete treeEvt;
+    delete treeEvtInfo;
+
+    if (mergePartials != "NULL") {
+        addPartialHistograms(outputFile, mergePartials);
+    }
+
+    // the histograms are normalized after the partial outputs are merged
+    if (partialOutput > 0) {
+        std::cout << "saving partial histograms" << std::endl;
+        outputFile->Write("", TObject::kOverwrite);
+        std::cout << "Closing the output file" << std::endl;
+        outputFile->Close();
+        std::cout << "running eventInfoAna() - END" << std::endl;
+        return;
+    }
 
     h_Q->Scale(1./h_Q->Integral(), "width");
 
@@ -273,23 +337,47 @@ int main(int argc, char* argv[]) {
 
     argOptions = ArgumentParser::ParseOptions(argc, argv);
 
-    if (nArgStr == 3) {
-        eventInfoAna(argStr.at(1), argStr.at(2));
-    }
-    else if (nArgStr == 2) {
-        eventInfoAna(argStr.at(1));
-    }
-    else if (nArgStr == 1) {
-        eventInfoAna();
+    // number of input files processed concurrently, each file in a separate process
+    int nParallel = (ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).c_str()) : 1;
+
+    if (nArgStr == 3 || nArgStr == 2 || nArgStr == 1) {
+        std::string inputFileName = (nArgStr >= 2) ? argStr.at(1) : "pythiaEvents.root";
+        std::string outputFileName = (nArgStr == 3) ? argStr.at(2) : "eventInfoAna_out.root";
+
+        std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+        if (nParallel <= 1 || inputFiles.size() <= 1) {
+            eventInfoAna(inputFileName, outputFileName);
+            return 0;
+        }
+
+        std::string mergedFileName = getPartialOutputName(outputFileName, -1);
+        bool jobsOK = runPartialJobs(inputFiles.size(), nParallel, outputFileName, mergedFileName, false,
+                [&](int iFile, std::string partialFileName) {
+                    setOption(argOptions, "--partialOutput", "1");
+                    setPartialEventIndex(argOptions, iFile);
+                    eventInfoAna(inputFiles[iFile], partialFileName);
+                });
+        if (!jobsOK) {
+            std::cout << "Partial jobs failed. Exiting." << std::endl;
+            return 1;
+        }
+        setOption(argOptions, "--mergePartials", mergedFileName);
+        eventInfoAna(inputFileName, outputFileName);
+        std::remove(mergedFileName.c_str());
     }
     else {
         std::cout << "Usage : \n" <<
                 "./eventInfoAna.exe <inputFileName> <outputFileName> [options]"
                 << std::endl;
+        std::cout << "The input file name can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
         std::cout << "Options are" << std::endl;
         std::cout << "--processList=<comma separated list of process codes>" << std::endl;
         std::cout << "--qMin=<minimum Q factorization scale>" << std::endl;
         std::cout << "--qMax=<maximum Q factorization scale>" << std::endl;
+        std::cout << "--nParallel=<number of input files processed concurrently, the outputs are merged at the end>" << std::endl;
+        treeReadSetup().printUsage();
+        eventIndexSelection().printUsage();
         return 1;
     }
     return 0;
@@ -18,13 +18,15 @@
 #include "TVirtualPad.h"
 #include "TApplication.h"
 
-// dictionary to read Pythia8::Event
-#include "../dictionary/dict4RootDct.cc"
 #include "../utils/pythiaUtil.h"
 #include "../../utilities/physicsUtil.h"
 #include "../../utilities/th1Util.h"
 #include "../../utilities/systemUtil.h"
 #include "../../utilities/ArgumentParser.h"
+#include "../../utilities/inputManifestUtil.h"
+#include "../../utilities/treeReadUtil.h"
+#include "../../utilities/inputFilesUtil.h"
+#include "../../utilities/eventIndexUtil.h"
 
 #include <iostream>
 #include <iomanip>
@@ -59,27 +61,67 @@ void hardScatteringAna(std::string inputFileName, std::string outputFileName)
     double tagMaxEta = (ArgumentParser::ParseOptionInputSingle("--tagMaxEta", argOptions).size() > 0) ?
             std::atof(ArgumentParser::ParseOptionInputSingle("--tagMaxEta", argOptions).c_str()) : 999999;
 
+    // write the histograms before normalization, used for the partial jobs of --nParallel
+    int partialOutput = (ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).c_str()) : 0;
+    // file with the merged histograms of the partial jobs, they are added instead of running the event loop
+    std::string mergePartials = (ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions) : "NULL";
+
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    eventIndexSelection evtSelection;
+    evtSelection.parseOptions(argOptions);
+
     std::cout << "##### Optional Arguments #####" << std::endl;
     std::cout << "tagParticle = " << tagParticle.c_str() << std::endl;
     std::cout << "iStatusTag = " << iStatusTag << std::endl;
     std::cout << "iStatusProbe = " << iStatusProbe << std::endl;
     std::cout << "tagMinPt = " << tagMinPt << std::endl;
     std::cout << "tagMaxEta = " << tagMaxEta << std::endl;
+    std::cout << "partialOutput = " << partialOutput << std::endl;
+    std::cout << "mergePartials = " << mergePartials.c_str() << std::endl;
+    readSetup.printOptions();
+    evtSelection.printOptions();
     std::cout << "##### Optional Arguments - END #####" << std::endl;
 
-    TFile *inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    // trees read by this analysis, the info is used only for the events that pass the tag selection
+    inputManifest manifest("hardScatteringAna");
+    manifest.add("evt", {});
+    manifest.add("evtParton", {});
+    manifest.add("evtInfo", {});
+    manifest.print();
+
+    readSetup.init();
+
+    // the input can be a list of files, it is read as TChains
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+    std::cout << "number of input files = " << inputFiles.size() << std::endl;
+
     Pythia8::Event *event = 0;
-    TTree *treeEvt = (TTree*)inputFile->Get("evt");
+    TTree *treeEvt = getTreeInManifest(inputFiles, "evt", "evt", manifest);
     treeEvt->SetBranchAddress("event", &event);
 
     Pythia8::Event *eventParton = 0;
-    TTree* treeEvtParton = (TTree*)inputFile->Get("evtParton");
+    TTree* treeEvtParton = getTreeInManifest(inputFiles, "evtParton", "evtParton", manifest);
     treeEvtParton->SetBranchAddress("event", &eventParton);
 
     Pythia8::Info *info = 0;
-    TTree* treeEvtInfo = (TTree*)inputFile->Get("evtInfo");
+    TTree* treeEvtInfo = getTreeInManifest(inputFiles, "evtInfo", "evtInfo", manifest);
     treeEvtInfo->SetBranchAddress("info", &info);
 
+    readSetup.add("evt", treeEvt);
+    readSetup.add("evtParton", treeEvtParton);
+    readSetup.add("evtInfo", treeEvtInfo);
+
+    lazyInput inputEvt;
+    inputEvt.init("evt", treeEvt);
+    lazyInput inputEvtParton;
+    inputEvtParton.init("evtParton", treeEvtParton);
+    lazyInput inputEvtInfo;
+    inputEvtInfo.init("evtInfo", treeEvtInfo);
+
     TFile* outputFile = new TFile(outputFileName.c_str(), "RECREATE");
 
     TH1::SetDefaultSumw2();
@@ -418,6 +460,14 @@ void hardScatteringAna(std::string inputFileName, std::string outputFileName)
 
     int eventsAnalyzed = 0;
     int nEvents = treeEvt->GetEntries();
+    // the histograms of the partial jobs are added after the loop, the events are not read again
+    if (mergePartials != "NULL") {
+        nEvents = 0;
+    }
+    else if (!evtSelection.init(nEvents)) {
+        std::cout << "Event index cannot be applied. Exiting." << std::endl;
+        return;
+    }
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
@@ -426,9 +476,15 @@ void hardScatteringAna(std::string inputFileName, std::string outputFileName)
           std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
         }
 
-        treeEvt->GetEntry(iEvent);
-        treeEvtParton->GetEntry(iEvent);
-        treeEvtInfo->GetEntry(iEvent);
+        // events which do not pass the selection on the event index are not read
+        if (!evtSelection.passed(iEvent)) continue;
+
+        inputEvt.setEntry(iEvent);
+        inputEvtParton.setEntry(iEvent);
+        inputEvtInfo.setEntry(iEvent);
+
+        inputEvt.load();
+        inputEvtParton.load();
 
         // hard scatterer analysis
         // outgoing particles of the hardest subprocess are at index 5 and 6
@@ -603,6 +659,8 @@ void hardScatteringAna(std::string inputFileName, std::string outputFileName)
         h2_qscale_p1Pt->Fill(p1Pt[iStatusTag], event->scale());
         h2_qscale_p1Eta->Fill(TMath::Abs(p1Eta[iStatusTag]), event->scale());
 
+        inputEvtInfo.load();
+
         h2_pt_p1Pt_ratio_sOut_sHard->Fill(p1Pt[kHard], p1Pt[kOut] / p1Pt[kHard]);
         h2_pt_p1Eta_diff_sOut_sHard->Fill(p1Pt[kHard], p1Eta[kOut] - p1Eta[kHard]);
         h2_pt_p1Phi_diff_sOut_sHard->Fill(p1Pt[kHard], getDPHI(p1Phi[kOut], p1Phi[kHard]));
@@ -735,8 +793,28 @@ void hardScatteringAna(std::string inputFileName, std::string outputFileName)
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
-    std::cout << "Closing the input file" << std::endl;
-    inputFile->Close();
+    inputEvt.printStats();
+    inputEvtParton.printStats();
+    inputEvtInfo.printStats();
+    readSetup.printStats();
+    std::cout << "Closing the input files" << std::endl;
+    delete treeEvt;
+    delete treeEvtParton;
+    delete treeEvtInfo;
+
+    if (mergePartials != "NULL") {
+        addPartialHistograms(outputFile, mergePartials);
+    }
+
+    // the histograms are normalized after the partial outputs are merged
+    if (partialOutput > 0) {
+        std::cout << "saving partial histograms" << std::endl;
+        outputFile->Write("", TObject::kOverwrite);
+        std::cout << "Closing the output file" << std::endl;
+        outputFile->Close();
+        std::cout << "running hardScatteringAna() - END" << std::endl;
+        return;
+    }
 
     // Save histogram on file and close file.
     std::cout << "saving histograms" << std::endl;
@@ -810,22 +888,49 @@ int main(int argc, char* argv[]) {
 
     argOptions = ArgumentParser::ParseOptions(argc, argv);
 
-    if (nArgStr == 3) {
-        hardScatteringAna(argStr.at(1), argStr.at(2));
-    }
-    else if (nArgStr == 2) {
-        hardScatteringAna(argStr.at(1));
+    // number of input files processed concurrently, each file in a separate process
+    int nParallel = (ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).c_str()) : 1;
+
+    if (nArgStr == 3 || nArgStr == 2) {
+        std::string inputFileName = argStr.at(1);
+        std::string outputFileName = (nArgStr == 3) ? argStr.at(2) : "hardScatteringAna_out.root";
+
+        std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+        if (nParallel <= 1 || inputFiles.size() <= 1) {
+            hardScatteringAna(inputFileName, outputFileName);
+            return 0;
+        }
+
+        std::string mergedFileName = getPartialOutputName(outputFileName, -1);
+        bool jobsOK = runPartialJobs(inputFiles.size(), nParallel, outputFileName, mergedFileName, false,
+                [&](int iFile, std::string partialFileName) {
+                    setOption(argOptions, "--partialOutput", "1");
+                    setPartialEventIndex(argOptions, iFile);
+                    hardScatteringAna(inputFiles[iFile], partialFileName);
+                });
+        if (!jobsOK) {
+            std::cout << "Partial jobs failed. Exiting." << std::endl;
+            return 1;
+        }
+        setOption(argOptions, "--mergePartials", mergedFileName);
+        hardScatteringAna(inputFileName, outputFileName);
+        std::remove(mergedFileName.c_str());
     }
     else {
         std::cout << "Usage : \n" <<
                 "./hardScatteringAna.exe <inputFileName> <outputFileName> [options]"
                 << std::endl;
+        std::cout << "The input file name can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
         std::cout << "Options are" << std::endl;
         std::cout << "--tag=<label for tag particle>" << std::endl;
         std::cout << "--tagStatus=<code for status of tag particle>" << std::endl;
         std::cout << "--probeStatus=<code for status of probe particle>" << std::endl;
         std::cout << "--tagMinPt=<min pT for tag particle>" << std::endl;
         std::cout << "--tagMaxEta=<max |eta| for tag particle>" << std::endl;
+        std::cout << "--nParallel=<number of input files processed concurrently, the outputs are merged at the end>" << std::endl;
+        treeReadSetup().printUsage();
+        eventIndexSelection().printUsage();
         return 1;
     }
     return 0;
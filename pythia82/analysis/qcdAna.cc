@@ -23,12 +23,18 @@
 #include "TVirtualPad.h"
 #include "TApplication.h"
 #include "TLorentzVector.h"
+#include "TEntryList.h"
 
-// dictionary to read Pythia8::Event
-#include "../dictionary/dict4RootDct.cc"
 #include "../utils/pythiaUtil.h"
+#include "../utils/eventStore.h"
 #include "../../fastjet3/fastJetTree.h"
 #include "../../utilities/particleTree.h"
+#include "../../utilities/storageUtil.h"
+#include "../../utilities/inputManifestUtil.h"
+#include "../../utilities/treeReadUtil.h"
+#include "../../utilities/inputFilesUtil.h"
+#include "../../utilities/eventIndexUtil.h"
+#include "../../utilities/shardInfoUtil.h"
 #include "../../utilities/physicsUtil.h"
 #include "../../utilities/th1Util.h"
 #include "../../utilities/ArgumentParser.h"
@@ -77,6 +83,20 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
             std::atof(ArgumentParser::ParseOptionInputSingle("--maxJetEta", argOptions).c_str()) : 1.6;
     double minPartPt = (ArgumentParser::ParseOptionInputSingle("--minPartPt", argOptions).size() > 0) ?
             std::atof(ArgumentParser::ParseOptionInputSingle("--minPartPt", argOptions).c_str()) : 1;
+    // directory of the event stores written by convertEventStore, evt and evtParton are read from the stores instead of the trees
+    std::string eventStore = (ArgumentParser::ParseOptionInputSingle("--eventStore", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--eventStore", argOptions) : "NULL";
+    // write the histograms before normalization, used for the partial jobs of --nParallel
+    int partialOutput = (ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).c_str()) : 0;
+    // file with the merged histograms of the partial jobs, they are added instead of running the event loop
+    std::string mergePartials = (ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mergePartials", argOptions) : "NULL";
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    eventIndexSelection evtSelection;
+    evtSelection.parseOptions(argOptions);
 
     std::cout << "##### Optional Arguments #####" << std::endl;
     std::cout << "particleFile = " << particleFileName.c_str() << std::endl;
@@ -90,32 +110,82 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
     std::cout << "minVJetPt = " << minVJetPt << std::endl;
     std::cout << "maxJetEta = " << maxJetEta << std::endl;
     std::cout << "minPartPt = " << minPartPt << std::endl;
+    std::cout << "eventStore = " << eventStore.c_str() << std::endl;
+    std::cout << "partialOutput = " << partialOutput << std::endl;
+    std::cout << "mergePartials = " << mergePartials.c_str() << std::endl;
+    readSetup.printOptions();
+    evtSelection.printOptions();
     std::cout << "##### Optional Arguments - END #####" << std::endl;
 
-    // Set up the ROOT TFile and TTree.
-    TFile* eventFile = TFile::Open(eventFileName.c_str(),"READ");
+    // this (using external file for particles) is mostly NOT the case
+    bool useExtParticleTree = (particleFileName != "NULL" && particleTreeName != "NULL");
+    bool useEventStore = (eventStore != "NULL");
+    bool doMergePartials = (mergePartials != "NULL");
+
+    // trees and branches read by this analysis
+    inputManifest manifest("qcdAna");
+    if (!useEventStore) {
+        manifest.add("evt", {});
+        manifest.add("evtParton", {});
+    }
+    manifest.add("evtInfo", {});
+    manifest.add("jets", {"nJet", "jetpt", "jeteta", "jetphi", "partonidx", "partonoutidx"});
+    if (useExtParticleTree) {
+        manifest.add("particles", {"n", "pt", "eta", "phi", "chg"});
+    }
+    manifest.print();
+
+    readSetup.init();
+
+    // the inputs can be lists of files, they are read as TChains
+    std::vector<std::string> eventFiles = expandInputFiles(eventFileName);
+    std::vector<std::string> jetFiles = expandInputFiles(jetFileName);
+    std::cout << "number of event files = " << eventFiles.size() << std::endl;
+    std::cout << "number of jet files = " << jetFiles.size() << std::endl;
+
+    // Set up the ROOT TChain.
     Pythia8::Event* eventAll = 0;
 
     std::string evtTreePath = "evt";
-    TTree* treeEvt = (TTree*)eventFile->Get(evtTreePath.c_str());
-    treeEvt->SetBranchAddress("event", &eventAll);
+    TTree* treeEvt = getTreeInManifest(eventFiles, evtTreePath, "evt", manifest);
+    if (treeEvt != 0) treeEvt->SetBranchAddress("event", &eventAll);
 
     Pythia8::Event* eventParton = 0;
     std::string evtPartonTreePath = "evtParton";
-    TTree* treeEvtParton = (TTree*)eventFile->Get(evtPartonTreePath.c_str());
-    treeEvtParton->SetBranchAddress("event", &eventParton);
+    TTree* treeEvtParton = getTreeInManifest(eventFiles, evtPartonTreePath, "evtParton", manifest);
+    if (treeEvtParton != 0) treeEvtParton->SetBranchAddress("event", &eventParton);
+
+    eventStoreReader storeEvt;
+    eventStoreReader storeEvtParton;
+    if (useEventStore) {
+        if (!storeEvt.open(eventStore + "/" + evtTreePath) || !storeEvtParton.open(eventStore + "/" + evtPartonTreePath)) {
+            std::cout << "Event store " << eventStore.c_str() << " cannot be read. Exiting." << std::endl;
+            return;
+        }
+        eventAll = new Pythia8::Event();
+        eventParton = new Pythia8::Event();
+    }
 
     Pythia8::Info *info = 0;
-    TTree* treeEvtInfo = (TTree*)eventFile->Get("evtInfo");
+    TTree* treeEvtInfo = getTreeInManifest(eventFiles, "evtInfo", "evtInfo", manifest);
+    if (treeEvtInfo == 0) {
+        std::cout << "Event info tree cannot be read. Exiting." << std::endl;
+        return;
+    }
     treeEvtInfo->SetBranchAddress("info", &info);
 
     Pythia8::Event* event = eventAll;
     Pythia8::Event* eventParticle = eventAll;
 
-    TFile *jetFile = TFile::Open(jetFileName.c_str(),"READ");
     fastJetTree fjt;
-    TTree *jetTree = (TTree*)jetFile->Get(jetTreeName.c_str());
-    fjt.setupTreeForReading(jetTree);
+    // the jets can be either a TTree or an RNTuple
+    storageReader jetReader(jetFiles, jetTreeName);
+    if (!jetReader.isValid()) {
+        std::cout << "Jet tree " << jetTreeName.c_str() << " cannot be read. Exiting." << std::endl;
+        return;
+    }
+    jetReader.setActiveBranches(manifest.getBranches("jets"));
+    fjt.setupTreeForReading(jetReader);
 
     std::string akStr = "ak";
     std::string jetStr = "jets";
@@ -124,27 +194,32 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
     double jetR = std::atof(jetRStr.c_str()) / 10;
     double jetR2 = jetR * jetR;
 
+    // use the jet-parton matching done at clustering time if available
+    bool hasPartonMatch = (jetReader.hasBranch("partonidx") && jetReader.hasBranch("partonoutidx"));
+
     std::cout << "##### Parameters (cont'd.) #####" << std::endl;
     std::cout << "jetR = " << jetR << std::endl;
+    std::cout << "hasPartonMatch = " << hasPartonMatch << std::endl;
     std::cout << "##### Parameters (cont'd.) - END #####" << std::endl;
 
-    // this (using external file for particles) is mostly NOT the case
-    bool useExtParticleTree = (particleFileName != "NULL" && particleTreeName != "NULL");
-
-    TFile* particleFile = 0;
-    TTree* treeParticles = 0;
+    storageReader* readerParticles = 0;
     particleTree partt;
     if (useExtParticleTree) {
-        if (particleFileName == eventFileName.c_str()) {
-            particleFile = eventFile;
-        }
-        else {
-            particleFile = TFile::Open(particleFileName.c_str(),"READ");
+        readerParticles = new storageReader(expandInputFiles(particleFileName), particleTreeName);
+        if (!readerParticles->isValid()) {
+            std::cout << "Particle tree " << particleTreeName.c_str() << " cannot be read. Exiting." << std::endl;
+            return;
         }
-        treeParticles = (TTree*)particleFile->Get(particleTreeName.c_str());
-        partt.setupTreeForReading(treeParticles);
+        readerParticles->setActiveBranches(manifest.getBranches("particles"));
+        partt.setupTreeForReading(*readerParticles);
     }
 
+    readSetup.add("evt", treeEvt);
+    readSetup.add("evtParton", treeEvtParton);
+    readSetup.add("evtInfo", treeEvtInfo);
+    readSetup.add("jets", &jetReader);
+    readSetup.add("particles", readerParticles);
+
     std::cout << "initialize the Pythia class to obtain info that is not accessible through event TTree." << std::endl;
     std::cout << "##### Pythia initialize #####" << std::endl;
     Pythia8::Pythia pythia;
@@ -155,11 +230,18 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
         eventExternal.init("Event record for external particles", &pythia.particleData);
         std::cout << "##### Event record for external particles initialized #####" << std::endl;
     }
+    if (useEventStore) {
+        eventAll->init("Event record read from the event store", &pythia.particleData);
+        eventParton->init("Parton level event record read from the event store", &pythia.particleData);
+    }
 
     TFile* outputFile = new TFile(outputFileName.c_str(), "RECREATE");
 
     TH1::SetDefaultSumw2();
 
+    // cross section and number of events of the inputs, used for the weighted merging of the outputs
+    TH1D* h_shardInfo = newShardInfo();
+
     enum ANALYSISTYPES {
         k_vJet,
         k_leadJet,
@@ -562,8 +644,8 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
     double max_dR2_jet_particle = max_dR_jet_particle * max_dR_jet_particle;
 
     int eventsAnalyzed = 0;
-    int nEvents = treeEvt->GetEntries();
-    int nEventsJets = jetTree->GetEntries();
+    int nEvents = (useEventStore) ? storeEvt.getEntries() : treeEvt->GetEntries();
+    int nEventsJets = jetReader.getEntries();
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "nEventsJets = " << nEventsJets << std::endl;
     if (nEvents != nEventsJets) {
@@ -571,20 +653,61 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
         std::cout << "exiting." << std::endl;
         return;
     }
-    std::cout << "Loop STARTED" << std::endl;
+    // the histograms of the partial jobs are added after the loop, the events are not read again
+    if (doMergePartials) {
+        nEvents = 0;
+    }
+    else if (!evtSelection.init(nEvents)) {
+        std::cout << "Event index cannot be applied. Exiting." << std::endl;
+        return;
+    }
+
+    // the inputs which are not in the manifest (ex. external particles if not used) stay inactive
+    lazyInput inputEvt;
+    inputEvt.init("evt", treeEvt);
+    if (useEventStore) {
+        inputEvt.init("evt", [&](Long64_t entry) { storeEvt.fillEvent(entry, *eventAll); });
+    }
+    lazyInput inputEvtParton;
+    inputEvtParton.init("evtParton", treeEvtParton);
+    if (useEventStore) {
+        inputEvtParton.init("evtParton", [&](Long64_t entry) { storeEvtParton.fillEvent(entry, *eventParton); });
+    }
+    lazyInput inputEvtInfo;
+    inputEvtInfo.init("evtInfo", treeEvtInfo);
+    lazyInput inputJets;
+    // the jets of an entry with the flat layout are complete after decode()
+    inputJets.init("jets", [&](Long64_t entry) { jetReader.getEntry(entry); fjt.decode(); });
+    lazyInput inputParticles;
+    inputParticles.init("particles", readerParticles);
+
+    // preselection : the cuts which need only the info and the jets are applied before the main loop,
+    // so the full events are read only for the entries in the list.
+    // The selection of V+jet events needs the full event, the jets of those events are not preselected.
+    bool preselectJets = (anaType == k_leadJet || anaType == k_dijet || anaType == k_inclusiveJet);
+    TEntryList* entryList = new TEntryList("preselection", "entries passing the preselection");
+    // not written to the output file
+    entryList->SetDirectory(0);
+    int iTreeInfo = -1;
+    double xsecInfo = 0;
+    int nEventsInfo = 0;
+    std::cout << "Preselection STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
 
-        if (iEvent % 10000 == 0)  {
-          std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
-        }
+        inputEvtInfo.setEntry(iEvent);
+        inputEvtInfo.load();
 
-        treeEvt->GetEntry(iEvent);
-        treeEvtParton->GetEntry(iEvent);
-        treeEvtInfo->GetEntry(iEvent);
-        jetTree->GetEntry(iEvent);
-        if (useExtParticleTree) {
-            treeParticles->GetEntry(iEvent);
+        // the cross section estimate of an input file is the one at its last event
+        if (treeEvtInfo->GetTreeNumber() != iTreeInfo) {
+            addShardInfo(h_shardInfo, xsecInfo, nEventsInfo);
+            iTreeInfo = treeEvtInfo->GetTreeNumber();
+            nEventsInfo = 0;
         }
+        xsecInfo = info->sigmaGen();
+        nEventsInfo++;
+
+        // the events which do not pass the selection on the event index are still counted in the shard info
+        if (!evtSelection.passed(iEvent)) continue;
 
         if (processType == kQCD_all) {
 
@@ -614,6 +737,45 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
             continue;
         }
 
+        if (preselectJets) {
+            inputJets.setEntry(iEvent);
+            inputJets.load();
+
+            // leading jet must be within the eta range, the jets in the inclusive analysis must also pass the pt cut
+            bool passedJet = false;
+            for (int i = 0; i < fjt.nJet; ++i) {
+                if (!(TMath::Abs((*fjt.jeteta)[i]) < maxJetEta)) continue;
+                if (anaType == k_inclusiveJet && !((*fjt.jetpt)[i] > minVJetPt)) continue;
+                passedJet = true;
+                break;
+            }
+            if (!passedJet) continue;
+        }
+
+        entryList->Enter(iEvent);
+    }
+    addShardInfo(h_shardInfo, xsecInfo, nEventsInfo);
+    std::cout << "Preselection ENDED" << std::endl;
+    int nEventsPreselected = entryList->GetN();
+    std::cout << "nEventsPreselected = " << nEventsPreselected << std::endl;
+
+    std::cout << "Loop STARTED" << std::endl;
+    for (int iEntry = 0; iEntry < nEventsPreselected; ++iEntry) {
+
+        if (iEntry % 10000 == 0)  {
+          std::cout << "current entry = " <<iEntry<<" out of "<<nEventsPreselected<<" : "<<std::setprecision(2)<<(double)iEntry/nEventsPreselected*100<<" %"<<std::endl;
+        }
+
+        int iEvent = entryList->GetEntry(iEntry);
+
+        // the trees are read when they are first used in this event
+        inputEvt.setEntry(iEvent);
+        inputEvtParton.setEntry(iEvent);
+        inputJets.setEntry(iEvent);
+        inputParticles.setEntry(iEvent);
+
+        inputEvt.load();
+
         // jet analysis
         // particles from hard scattering are at index 5 and 6
         int ip1 = 5;
@@ -643,6 +805,7 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
 
             iV = iHardV;
             if (ewBosonType == kOutgoingHardPhoton || ewBosonType == kOutgoingHardZ) {
+                inputEvtParton.load();
                 int eventPartonSize = eventParton->size();
                 // search the hard scattering photon in outgoing particles
                 int iOutV = -1;
@@ -721,8 +884,9 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
                         TLorentzVector vecL1;
                         TLorentzVector vecL2;
 
-                        vecL1.SetPtEtaPhiM((*event)[i].pT(), (*event)[i].eta(), (*event)[i].phi(), (*event)[i].m0());
-                        vecL2.SetPtEtaPhiM((*event)[j].pT(), (*event)[j].eta(), (*event)[j].phi(), (*event)[j].m0());
+                        // the particle data table is not stored with the events, the masses are taken from the Pythia instance
+                        vecL1.SetPtEtaPhiM((*event)[i].pT(), (*event)[i].eta(), (*event)[i].phi(), pythia.particleData.m0((*event)[i].id()));
+                        vecL2.SetPtEtaPhiM((*event)[j].pT(), (*event)[j].eta(), (*event)[j].phi(), pythia.particleData.m0((*event)[j].id()));
 
                         TLorentzVector vecL1L2 = vecL1 + vecL2;
 
@@ -770,6 +934,12 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
         std::vector<int> typesQGJ2;
         int nTypesQGJ2 = -1;
 
+        // for V+jet, the jets are read after the V selection
+        if (anaType != k_vJet) {
+            inputEvtParton.load();
+            inputJets.load();
+        }
+
         if (anaType == k_vJet) {
 
             if (vIsPho) {
@@ -786,6 +956,9 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
             h_vPt->Fill(vPt);
             if (!(vPt > minVPt)) continue;
 
+            inputEvtParton.load();
+            inputJets.load();
+
             h_vEta->Fill(TMath::Abs(vEta));
             h2_vEta_vPt->Fill(TMath::Abs(vEta), vPt);
             h2_qscale_vPt->Fill(vPt, event->scale());
@@ -829,10 +1002,16 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
             }
 
             // associated parton is the one that is closest in eta-phi
-            double dR2parton1 = getDR2((*fjt.jeteta)[iMaxJet], (*fjt.jetphi)[iMaxJet], (*event)[ip1].eta(), (*event)[ip1].phi());
-            double dR2parton2 = getDR2((*fjt.jeteta)[iMaxJet], (*fjt.jetphi)[iMaxJet], (*event)[ip2].eta(), (*event)[ip2].phi());
-            iParton = (dR2parton1 < dR2parton2) ? ip1 : ip2;
-            iPartonOut = getIndexLeadingOutDaughter(event, eventParton, iParton);
+            if (hasPartonMatch) {
+                iParton = (*fjt.partonidx)[iMaxJet];
+                iPartonOut = (*fjt.partonoutidx)[iMaxJet];
+            }
+            else {
+                double dR2parton1 = getDR2((*fjt.jeteta)[iMaxJet], (*fjt.jetphi)[iMaxJet], (*event)[ip1].eta(), (*event)[ip1].phi());
+                double dR2parton2 = getDR2((*fjt.jeteta)[iMaxJet], (*fjt.jetphi)[iMaxJet], (*event)[ip2].eta(), (*event)[ip2].phi());
+                iParton = (dR2parton1 < dR2parton2) ? ip1 : ip2;
+                iPartonOut = getIndexLeadingOutDaughter(event, eventParton, iParton);
+            }
 
             if (isQuark((*event)[iParton])) {
                 typesQG = {kInclusive, kQuark};
@@ -867,10 +1046,16 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
                 // associated parton is the one that is closest in eta-phi
                 // It is not assumed that the parton associated to the subleading jet is the one that recoils from the one for leading jet
                 // Subleading jet and leading jet having the same associated parton is not excluded.
-                double dR2parton1 = getDR2((*fjt.jeteta)[iMaxJet2], (*fjt.jetphi)[iMaxJet2], (*event)[ip1].eta(), (*event)[ip1].phi());
-                double dR2parton2 = getDR2((*fjt.jeteta)[iMaxJet2], (*fjt.jetphi)[iMaxJet2], (*event)[ip2].eta(), (*event)[ip2].phi());
-                iPartonJ2 = (dR2parton1 < dR2parton2) ? ip1 : ip2;
-                iPartonJ2Out = getIndexLeadingOutDaughter(event, eventParton, iPartonJ2);
+                if (hasPartonMatch) {
+                    iPartonJ2 = (*fjt.partonidx)[iMaxJet2];
+                    iPartonJ2Out = (*fjt.partonoutidx)[iMaxJet2];
+                }
+                else {
+                    double dR2parton1 = getDR2((*fjt.jeteta)[iMaxJet2], (*fjt.jetphi)[iMaxJet2], (*event)[ip1].eta(), (*event)[ip1].phi());
+                    double dR2parton2 = getDR2((*fjt.jeteta)[iMaxJet2], (*fjt.jetphi)[iMaxJet2], (*event)[ip2].eta(), (*event)[ip2].phi());
+                    iPartonJ2 = (dR2parton1 < dR2parton2) ? ip1 : ip2;
+                    iPartonJ2Out = getIndexLeadingOutDaughter(event, eventParton, iPartonJ2);
+                }
 
                 if (isQuark((*event)[iPartonJ2])) {
                     typesQGJ2 = {kInclusive, kQuark};
@@ -887,6 +1072,8 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
 
         // prepare particle trees
         if (useExtParticleTree) {
+            inputParticles.load();
+            partt.decode();
             eventExternal.clear();
 
             if (sigBkgType == SIGBKGTYPES::kCORR_RAW) {
@@ -955,10 +1142,16 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
                 if (!(TMath::Abs(jeteta) < maxJetEta)) continue;
 
                 // associated parton is the one that is closest in eta-phi
-                double dR2parton1 = getDR2(jeteta, jetphi, (*event)[ip1].eta(), (*event)[ip1].phi());
-                double dR2parton2 = getDR2(jeteta, jetphi, (*event)[ip2].eta(), (*event)[ip2].phi());
-                iParton = (dR2parton1 < dR2parton2) ? ip1 : ip2;
-                iPartonOut = getIndexLeadingOutDaughter(event, eventParton, iParton);
+                if (hasPartonMatch) {
+                    iParton = (*fjt.partonidx)[i];
+                    iPartonOut = (*fjt.partonoutidx)[i];
+                }
+                else {
+                    double dR2parton1 = getDR2(jeteta, jetphi, (*event)[ip1].eta(), (*event)[ip1].phi());
+                    double dR2parton2 = getDR2(jeteta, jetphi, (*event)[ip2].eta(), (*event)[ip2].phi());
+                    iParton = (dR2parton1 < dR2parton2) ? ip1 : ip2;
+                    iPartonOut = getIndexLeadingOutDaughter(event, eventParton, iParton);
+                }
 
                 if (isQuark((*event)[iParton])) {
                     typesQG = {kInclusive, kQuark};
@@ -1346,13 +1539,34 @@ void qcdAna(std::string eventFileName, std::string jetFileName, std::string jetT
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
-    std::cout << "Closing the event file" << std::endl;
-    eventFile->Close();
-    std::cout << "Closing the jet file" << std::endl;
-    jetFile->Close();
+    inputEvt.printStats();
+    inputEvtParton.printStats();
+    inputEvtInfo.printStats();
+    inputJets.printStats();
+    inputParticles.printStats();
+    readSetup.printStats();
+    delete entryList;
+    std::cout << "Closing the event files" << std::endl;
+    delete treeEvt;
+    delete treeEvtParton;
+    delete treeEvtInfo;
     if (useExtParticleTree) {
-        std::cout << "Closing the particle file" << std::endl;
-        particleFile->Close();
+        std::cout << "Closing the particle files" << std::endl;
+        delete readerParticles;
+    }
+
+    if (doMergePartials) {
+        addPartialHistograms(outputFile, mergePartials);
+    }
+
+    // the histograms are normalized after the partial outputs are merged
+    if (partialOutput > 0) {
+        std::cout << "saving partial histograms" << std::endl;
+        outputFile->Write("", TObject::kOverwrite);
+        std::cout << "Closing the output file" << std::endl;
+        outputFile->Close();
+        std::cout << "running qcdAna() - END" << std::endl;
+        return;
     }
 
     // Save histogram on file and close file.
@@ -1509,16 +1723,47 @@ int main(int argc, char* argv[]) {
 
     argOptions = ArgumentParser::ParseOptions(argc, argv);
 
-    if (nArgStr == 5) {
-        qcdAna(argStr.at(1), argStr.at(2), argStr.at(3), argStr.at(4));
-    }
-    else if (nArgStr == 4) {
-        qcdAna(argStr.at(1), argStr.at(2), argStr.at(3));
+    // number of input files processed concurrently, each file in a separate process
+    int nParallel = (ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).c_str()) : 1;
+
+    if (nArgStr == 5 || nArgStr == 4) {
+        std::string outputFileName = (nArgStr == 5) ? argStr.at(4) : "qcdAna_out.root";
+
+        std::vector<std::string> eventFiles = expandInputFiles(argStr.at(1));
+        if (nParallel <= 1 || eventFiles.size() <= 1) {
+            qcdAna(argStr.at(1), argStr.at(2), argStr.at(3), outputFileName);
+            return 0;
+        }
+
+        std::vector<std::string> jetFiles = expandInputFiles(argStr.at(2));
+        std::vector<std::string> particleFiles = expandInputFiles(ArgumentParser::ParseOptionInputSingle("--particleFile", argOptions));
+        if (jetFiles.size() != eventFiles.size() || (particleFiles.size() > 0 && particleFiles.size() != eventFiles.size())) {
+            std::cout << "The lists of event, jet and particle files have different number of files. Exiting." << std::endl;
+            return 1;
+        }
+
+        std::string mergedFileName = getPartialOutputName(outputFileName, -1);
+        bool jobsOK = runPartialJobs(eventFiles.size(), nParallel, outputFileName, mergedFileName, false,
+                [&](int iFile, std::string partialFileName) {
+                    setOption(argOptions, "--partialOutput", "1");
+                    setPartialEventIndex(argOptions, iFile);
+                    if (particleFiles.size() > 0) setOption(argOptions, "--particleFile", particleFiles[iFile]);
+                    qcdAna(eventFiles[iFile], jetFiles[iFile], argStr.at(3), partialFileName);
+                });
+        if (!jobsOK) {
+            std::cout << "Partial jobs failed. Exiting." << std::endl;
+            return 1;
+        }
+        setOption(argOptions, "--mergePartials", mergedFileName);
+        qcdAna(argStr.at(1), argStr.at(2), argStr.at(3), outputFileName);
+        std::remove(mergedFileName.c_str());
     }
     else {
         std::cout << "Usage : \n" <<
                 "./qcdAna.exe <eventFileName> <jetFileName> <jetTreeName> <outputFileName> [options]"
                 << std::endl;
+        std::cout << "The input file names can be comma separated lists, wildcards or .list/.txt files with one file per line" << std::endl;
         std::cout << "Options are" << std::endl;
         std::cout << "--particleFile=<file containing particle tree to be used>" << std::endl;
         std::cout << "--particleTree=<path of particle tree in file>" << std::endl;
@@ -1531,6 +1776,10 @@ int main(int argc, char* argv[]) {
         std::cout << "--minVJetPt=<maximum jet pT in V+jet analysis>" << std::endl;
         std::cout << "--maxJetEta=<maximum jet eta>" << std::endl;
         std::cout << "--minPartPt=<minimum particle pT>" << std::endl;
+        std::cout << "--eventStore=<directory of the event stores written by convertEventStore>" << std::endl;
+        std::cout << "--nParallel=<number of input files processed concurrently, the outputs are merged at the end>" << std::endl;
+        treeReadSetup().printUsage();
+        eventIndexSelection().printUsage();
         return 1;
     }
     return 0;
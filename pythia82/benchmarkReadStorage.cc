@@ -0,0 +1,208 @@
+#include "TROOT.h"
+#include "TTree.h"
+#include "TFile.h"
+
+#include "../fastjet3/fastJetTree.h"
+#include "../utilities/particleTree.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/ArgumentParser.h"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+std::vector<std::string> argOptions;
+
+/*
+ * compares the read throughput of the TTree and RNTuple backends for a jet tree (fastJetTree) or a particle tree (particleTree).
+ * The input tree is copied once with each backend into the same temporary file, so that both copies have the same
+ * compression settings, then all entries of each copy are read "nRepeat" times.
+ * The type of the tree is detected from its branches.
+ */
+void benchmarkReadStorage(std::string inputFileName, std::string treePath, std::string tmpFileName = "benchmarkReadStorage_tmp.root");
+template <typename T> void addBranches(T& obj, storageWriter& w, TTree* t);
+void addBranches(fastJetTree& fjt, storageWriter& w, TTree* t);
+template <typename T> void copyTree(TTree* t, storageWriter& w);
+template <typename T> double readAll(storageReader& r, int nRepeat, double& sum);
+double sumEntry(fastJetTree& fjt);
+double sumEntry(particleTree& partt);
+
+void benchmarkReadStorage(std::string inputFileName, std::string treePath, std::string tmpFileName)
+{
+    std::cout << "running benchmarkReadStorage()" << std::endl;
+
+    std::cout << "##### Parameters #####" << std::endl;
+    std::cout << "inputFileName = " << inputFileName.c_str() << std::endl;
+    std::cout << "treePath = " << treePath.c_str() << std::endl;
+    std::cout << "tmpFileName = " << tmpFileName.c_str() << std::endl;
+    std::cout << "##### Parameters - END #####" << std::endl;
+
+    int nRepeat = (ArgumentParser::ParseOptionInputSingle("--nRepeat", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nRepeat", argOptions).c_str()) : 3;
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "nRepeat = " << nRepeat << std::endl;
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    if (getStorageBackendIndex(STORAGE::BACKENDNAMES[STORAGE::kRNTuple]) < 0) {
+        std::cout << "RNTuple is not available in this ROOT version. Exiting." << std::endl;
+        return;
+    }
+
+    TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    TTree* inputTree = (TTree*)inputFile->Get(treePath.c_str());
+    if (inputTree == 0) {
+        std::cout << "Tree " << treePath.c_str() << " is not found in " << inputFileName.c_str() << ". Exiting." << std::endl;
+        return;
+    }
+
+    bool isJetTree = (inputTree->GetBranch("nJet") != 0);
+    const char* firstArray = (isJetTree) ? "jetpt" : "pt";
+    // the vectors of the RNTuple writer are filled directly by the input tree, this requires vector branches
+    if (isFlatBranch(inputTree, firstArray)) {
+        std::cout << "Tree " << treePath.c_str() << " has the flat layout, only vector branches are supported. Exiting." << std::endl;
+        return;
+    }
+    std::cout << "tree type = " << ((isJetTree) ? "fastJetTree" : "particleTree") << std::endl;
+
+    // the same names for both copies, the RNTuple must be at the top directory
+    std::string names[STORAGE::kN_BACKENDS] = {"benchmarkTTree", "benchmarkRNTuple"};
+
+    TFile* tmpFile = new TFile(tmpFileName.c_str(), "RECREATE");
+    for (int i = 0; i < STORAGE::kN_BACKENDS; ++i) {
+        storageWriter w(tmpFile, names[i], inputTree->GetTitle(), i);
+        if (isJetTree) copyTree<fastJetTree>(inputTree, w);
+        else           copyTree<particleTree>(inputTree, w);
+        w.close();
+    }
+    tmpFile->Write("", TObject::kOverwrite);
+    tmpFile->Close();
+    inputFile->Close();
+
+    std::cout << std::setw(10) << "backend" << std::setw(15) << "nEntries" << std::setw(20) << "time/entry (us)"
+              << std::setw(20) << "entries/s" << std::setw(20) << "checksum" << std::endl;
+    tmpFile = TFile::Open(tmpFileName.c_str(), "READ");
+    for (int i = 0; i < STORAGE::kN_BACKENDS; ++i) {
+        storageReader r(tmpFile, names[i]);
+        // sum of all values is printed so that both copies can be compared and the reading is not optimized away
+        double sum = 0;
+        double timeMs = (isJetTree) ? readAll<fastJetTree>(r, nRepeat, sum) : readAll<particleTree>(r, nRepeat, sum);
+
+        Long64_t nEntries = r.getEntries();
+        double timePerEntry = (nEntries > 0) ? timeMs * 1000 / (nEntries * nRepeat) : 0;
+        double entriesPerSec = (timeMs > 0) ? nEntries * nRepeat / (timeMs / 1000) : 0;
+        std::cout << std::setw(10) << STORAGE::BACKENDNAMES[i].c_str() << std::setw(15) << nEntries << std::setw(20) << timePerEntry
+                  << std::setw(20) << entriesPerSec << std::setw(20) << sum << std::endl;
+    }
+    tmpFile->Close();
+
+    std::cout << "running benchmarkReadStorage() - END" << std::endl;
+}
+
+template <typename T>
+void addBranches(T& obj, storageWriter& w, TTree* t)
+{
+    (void)t;
+    obj.branchTree(w);
+}
+
+/*
+ * registers the optional branch groups that exist in "t"
+ */
+void addBranches(fastJetTree& fjt, storageWriter& w, TTree* t)
+{
+    fjt.branchTree(w);
+    if (t->GetBranch("constidx")) fjt.branchTreeConstituents(w);
+    if (t->GetBranch("partonidx")) fjt.branchTreeParton(w);
+    if (t->GetBranch("jetarea")) fjt.branchTreeRho(w);
+    if (t->GetBranch("wtaeta")) fjt.branchTreeWTA(w);
+    if (t->GetBranch("ptd")) fjt.branchTreeSubstructure(w);
+    if (t->GetBranch("matchidx")) fjt.branchTreeMatch(w);
+}
+
+/*
+ * copies all entries of "t" with writer "w".
+ * The branches of "t" are read into the members registered with "w", so no copy of the content is needed.
+ */
+template <typename T>
+void copyTree(TTree* t, storageWriter& w)
+{
+    T obj;
+    addBranches(obj, w, t);
+    obj.setupTreeForReading(t);
+
+    Long64_t nEntries = t->GetEntries();
+    for (Long64_t i = 0; i < nEntries; ++i) {
+        t->GetEntry(i);
+        w.fill();
+    }
+    t->ResetBranchAddresses();
+}
+
+/*
+ * reads all entries "nRepeat" times, returns the time in ms
+ */
+template <typename T>
+double readAll(storageReader& r, int nRepeat, double& sum)
+{
+    T obj;
+    obj.setupTreeForReading(r);
+
+    Long64_t nEntries = r.getEntries();
+    auto timeStart = std::chrono::steady_clock::now();
+    for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+        for (Long64_t i = 0; i < nEntries; ++i) {
+            r.getEntry(i);
+            obj.decode();
+            sum += sumEntry(obj);
+        }
+    }
+    auto timeEnd = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(timeEnd - timeStart).count();
+}
+
+double sumEntry(fastJetTree& fjt)
+{
+    double res = 0;
+    for (int i = 0; i < fjt.nJet; ++i) {
+        res += (*fjt.jetpt)[i];
+    }
+    return res;
+}
+
+double sumEntry(particleTree& partt)
+{
+    double res = 0;
+    for (int i = 0; i < partt.n; ++i) {
+        res += (*partt.pt)[i];
+    }
+    return res;
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 4) {
+        benchmarkReadStorage(argv[1], argv[2], argv[3]);
+        return 0;
+    }
+    else if (nArgStr == 3) {
+        benchmarkReadStorage(argv[1], argv[2]);
+        return 0;
+    }
+    else {
+        std::cout << "Usage : \n" <<
+                "./benchmarkReadStorage.exe <inputFileName> <treePath> <tmpFileName>"
+                << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "nRepeat=<number of times all entries are read>" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,112 @@
+// Header file to access Pythia 8 program elements.
+#include "Pythia8/Pythia.h"
+#include "Pythia8/Event.h"
+#include "Pythia8/Basics.h"
+
+#include "TROOT.h"
+#include "TTree.h"
+#include "TFile.h"
+
+#include "utils/eventStore.h"
+#include "../utilities/systemUtil.h"
+#include "../utilities/ArgumentParser.h"
+
+#include <sys/stat.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+std::vector<std::string> argOptions;
+
+/*
+ * converts the Pythia8::Event trees of a file written by pythiaGenerateAndWrite into memory-mapped event stores.
+ * The store of tree "treeName" is written into directory "<outputDir>/<treeName>".
+ * The stores can be read by pythiaClusterJets and qcdAna with option --eventStore=<outputDir>
+ */
+void convertEventStore(std::string inputFileName, std::string outputDir, std::string treeNames = "evt,evtParton");
+
+void convertEventStore(std::string inputFileName, std::string outputDir, std::string treeNames)
+{
+    std::cout << "running convertEventStore()" << std::endl;
+
+    std::cout << "##### Parameters #####" << std::endl;
+    std::cout << "inputFileName = " << inputFileName.c_str() << std::endl;
+    std::cout << "outputDir = " << outputDir.c_str() << std::endl;
+    std::cout << "treeNames = " << treeNames.c_str() << std::endl;
+    std::cout << "##### Parameters - END #####" << std::endl;
+
+    TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    if (inputFile == 0 || inputFile->IsZombie()) {
+        std::cout << "Input file " << inputFileName.c_str() << " cannot be opened. Exiting." << std::endl;
+        return;
+    }
+
+    mkdir(outputDir.c_str(), 0755);
+
+    std::vector<std::string> treeNamesVec = split(treeNames, ",");
+    for (int iTree = 0; iTree < (int)treeNamesVec.size(); ++iTree) {
+
+        std::string treeName = treeNamesVec[iTree];
+        TTree* treeEvt = (TTree*)inputFile->Get(treeName.c_str());
+        if (treeEvt == 0) {
+            std::cout << "Tree " << treeName.c_str() << " is not found in " << inputFileName.c_str() << ". Exiting." << std::endl;
+            return;
+        }
+
+        Pythia8::Event* event = 0;
+        treeEvt->SetBranchAddress("event", &event);
+
+        std::string storeDir = outputDir + "/" + treeName;
+        eventStoreWriter writer;
+        if (!writer.open(storeDir)) {
+            std::cout << "Event store " << storeDir.c_str() << " cannot be written. Exiting." << std::endl;
+            return;
+        }
+
+        int nEvents = treeEvt->GetEntries();
+        std::cout << "tree = " << treeName.c_str() << ", nEvents = " << nEvents << std::endl;
+        std::cout << "Loop STARTED" << std::endl;
+        for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
+
+            if (iEvent % 10000 == 0)  {
+              std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
+            }
+
+            treeEvt->GetEntry(iEvent);
+            writer.write(*event);
+        }
+        std::cout << "Loop ENDED" << std::endl;
+        writer.close();
+        std::cout << "store = " << storeDir.c_str() << ", nParticles = " << writer.nParticles << std::endl;
+    }
+
+    std::cout<<"Closing the input file"<<std::endl;
+    inputFile->Close();
+
+    std::cout << "running convertEventStore() - END" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 4) {
+        convertEventStore(argv[1], argv[2], argv[3]);
+        return 0;
+    }
+    else if (nArgStr == 3) {
+        convertEventStore(argv[1], argv[2]);
+        return 0;
+    }
+    else {
+        std::cout << "Usage : \n" <<
+                "./convertEventStore.exe <inputFileName> <outputDir> <treeNames>"
+                << std::endl;
+        return 1;
+    }
+}
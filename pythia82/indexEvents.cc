@@ -0,0 +1,224 @@
+// Header file to access Pythia 8 program elements.
+#include "Pythia8/Pythia.h"
+#include "Pythia8/Event.h"
+#include "Pythia8/Basics.h"
+
+#include "TROOT.h"
+#include "TTree.h"
+#include "TFile.h"
+
+#include "utils/pythiaUtil.h"
+#include "../fastjet3/fastJetTree.h"
+#include "../utilities/eventIndexUtil.h"
+#include "../utilities/inputFilesUtil.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/systemUtil.h"
+#include "../utilities/ArgumentParser.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+std::vector<std::string> argOptions;
+
+/*
+ * writes the per-event index (utilities/eventIndexUtil.h) of the event files written by pythiaGenerateAndWrite.
+ * The index of "events.root" is written into "events_index.root", one index file per event file.
+ * The leading jet is taken from the jet tree "jetTree" of the jet files (option --jetFile), which must be in the same
+ * order as the event files, ex. the outputs of pythiaClusterJets. Without jet files, the jet fields are -1.
+ * The selected events can then be read by the jobs with options --eventIndex and --indexSelection.
+ */
+void indexEvents(std::string inputFileName);
+void fillEventIndex(eventIndexTree& idx, Pythia8::Event* event, Pythia8::Info* info, fastJetTree* fjt);
+
+void indexEvents(std::string inputFileName)
+{
+    std::cout << "running indexEvents()" << std::endl;
+
+    std::cout << "##### Parameters #####" << std::endl;
+    std::cout << "inputFileName = " << inputFileName.c_str() << std::endl;
+    std::cout << "##### Parameters - END #####" << std::endl;
+
+    std::string jetFileName = (ArgumentParser::ParseOptionInputSingle("--jetFile", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--jetFile", argOptions) : "NULL";
+    std::string jetTreeName = (ArgumentParser::ParseOptionInputSingle("--jetTree", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--jetTree", argOptions) : "ak4jets";
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "jetFile = " << jetFileName.c_str() << std::endl;
+    std::cout << "jetTree = " << jetTreeName.c_str() << std::endl;
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+    std::vector<std::string> jetFiles;
+    if (jetFileName != "NULL") {
+        jetFiles = expandInputFiles(jetFileName);
+        if (jetFiles.size() != inputFiles.size()) {
+            std::cout << "There are " << inputFiles.size() << " event files, but " << jetFiles.size() << " jet files. Exiting." << std::endl;
+            return;
+        }
+    }
+    std::cout << "number of input files = " << inputFiles.size() << std::endl;
+
+    for (int iFile = 0; iFile < (int)inputFiles.size(); ++iFile) {
+
+        std::cout << "input file = " << inputFiles[iFile].c_str() << std::endl;
+        TFile* inputFile = TFile::Open(inputFiles[iFile].c_str(), "READ");
+        if (inputFile == 0 || inputFile->IsZombie()) {
+            std::cout << "Input file " << inputFiles[iFile].c_str() << " cannot be opened. Exiting." << std::endl;
+            return;
+        }
+
+        TTree* treeEvt = (TTree*)inputFile->Get("evt");
+        TTree* treeEvtInfo = (TTree*)inputFile->Get("evtInfo");
+        if (treeEvt == 0 || treeEvtInfo == 0) {
+            std::cout << "Event trees are not found in " << inputFiles[iFile].c_str() << ". Exiting." << std::endl;
+            return;
+        }
+        Pythia8::Event* event = 0;
+        treeEvt->SetBranchAddress("event", &event);
+        Pythia8::Info* info = 0;
+        treeEvtInfo->SetBranchAddress("info", &info);
+
+        TFile* jetFile = 0;
+        storageReader* jetReader = 0;
+        fastJetTree* fjt = 0;
+        if (jetFiles.size() > 0) {
+            jetFile = TFile::Open(jetFiles[iFile].c_str(), "READ");
+            jetReader = (jetFile != 0) ? new storageReader(jetFile, jetTreeName) : 0;
+            if (jetReader == 0 || !jetReader->isValid()) {
+                std::cout << "Jet tree " << jetTreeName.c_str() << " cannot be read from " << jetFiles[iFile].c_str() << ". Exiting." << std::endl;
+                return;
+            }
+            jetReader->setActiveBranches({"nJet", "jetpt", "jeteta", "jetphi"});
+            fjt = new fastJetTree();
+            fjt->setupTreeForReading(*jetReader);
+        }
+
+        std::string indexFileName = getEventIndexName(inputFiles[iFile]);
+        TFile* outputFile = TFile::Open(indexFileName.c_str(), "RECREATE");
+        TTree* treeIndex = new TTree(EVENTINDEX::treeName.c_str(), EVENTINDEX::treeTitle.c_str());
+        eventIndexTree idx;
+        idx.branchTree(treeIndex);
+
+        int nEvents = treeEvt->GetEntries();
+        if (jetReader != 0 && jetReader->getEntries() != nEvents) {
+            std::cout << "Jet tree has " << jetReader->getEntries() << " entries, but there are " << nEvents << " events. Exiting." << std::endl;
+            return;
+        }
+        std::cout << "nEvents = " << nEvents << std::endl;
+        std::cout << "Loop STARTED" << std::endl;
+        for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
+
+            if (iEvent % 10000 == 0)  {
+              std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
+            }
+
+            treeEvt->GetEntry(iEvent);
+            treeEvtInfo->GetEntry(iEvent);
+            if (jetReader != 0) {
+                jetReader->getEntry(iEvent);
+                fjt->decode();
+            }
+
+            fillEventIndex(idx, event, info, fjt);
+            treeIndex->Fill();
+        }
+        std::cout << "Loop ENDED" << std::endl;
+
+        outputFile->cd();
+        treeIndex->Write("", TObject::kOverwrite);
+        std::cout << "index file = " << indexFileName.c_str() << std::endl;
+        outputFile->Close();
+
+        delete fjt;
+        delete jetReader;
+        if (jetFile != 0) jetFile->Close();
+        inputFile->Close();
+    }
+
+    std::cout << "running indexEvents() - END" << std::endl;
+}
+
+/*
+ * fills the index of the current event, "fjt" is 0 if there are no jets
+ */
+void fillEventIndex(eventIndexTree& idx, Pythia8::Event* event, Pythia8::Info* info, fastJetTree* fjt)
+{
+    idx.clear();
+
+    idx.code = info->code();
+    idx.q = info->QFac();
+
+    // outgoing particles of the hardest subprocess are at index 5 and 6
+    std::vector<int> indicesOutgoing = {5, 6};
+    for (int i = 0; i < 2; ++i) {
+        int iHard = indicesOutgoing[i];
+        if (iHard >= event->size()) continue;
+
+        idx.partonpt[i] = (*event)[iHard].pT();
+        idx.partoneta[i] = (*event)[iHard].eta();
+        idx.partonphi[i] = (*event)[iHard].phi();
+        idx.partonid[i] = (*event)[iHard].id();
+    }
+
+    if (fjt != 0) {
+        idx.nJet = fjt->nJet;
+        for (int i = 0; i < fjt->nJet; ++i) {
+            if ((*fjt->jetpt)[i] > idx.leadjetpt) {
+                idx.leadjetpt = (*fjt->jetpt)[i];
+                idx.leadjeteta = (*fjt->jeteta)[i];
+                idx.leadjetphi = (*fjt->jetphi)[i];
+            }
+        }
+    }
+
+    int iPho = -1;
+    int iZ = -1;
+    int eventSize = event->size();
+    for (int i = 0; i < eventSize; ++i) {
+
+        if (isGamma((*event)[i]) && (*event)[i].isFinal()) {
+            if (iPho == -1 || (*event)[i].pT() > (*event)[iPho].pT())  iPho = i;
+        }
+        else if (isZboson((*event)[i])) {
+            if (iZ == -1 || (*event)[i].pT() > (*event)[iZ].pT())  iZ = i;
+        }
+    }
+
+    if (iPho != -1) {
+        idx.phopt = (*event)[iPho].pT();
+        idx.phoeta = (*event)[iPho].eta();
+        idx.phophi = (*event)[iPho].phi();
+        idx.phoiso = isolationEt(event, iPho, 0.4, true, true);
+    }
+    if (iZ != -1) {
+        idx.zpt = (*event)[iZ].pT();
+        idx.zeta = (*event)[iZ].eta();
+        idx.zphi = (*event)[iZ].phi();
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 2) {
+        indexEvents(argStr.at(1));
+        return 0;
+    }
+    else {
+        std::cout << "Usage : \n" <<
+                "./indexEvents.exe <inputFileName> [options]"
+                << std::endl;
+        std::cout << "The input file name can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "--jetFile=<files with the jets of the events, in the same order as the input files>" << std::endl;
+        std::cout << "--jetTree=<name of the jet tree, default is ak4jets>" << std::endl;
+        return 1;
+    }
+}
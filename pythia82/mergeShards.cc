@@ -0,0 +1,305 @@
+#include "TROOT.h"
+#include "TClass.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TH1.h"
+#include "TKey.h"
+#include "TList.h"
+
+#include "../utilities/inputFilesUtil.h"
+#include "../utilities/shardInfoUtil.h"
+#include "../utilities/ArgumentParser.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::vector<std::string> argOptions;
+
+/*
+ * merges the outputs of jobs over parts of the events (shards), ex. the qcdAna outputs of a sample split into many files.
+ *  - histograms are summed in a parallel tree reduction : each of nThreadsMerge threads sums the shards of a contiguous
+ *    group, then the sums of the groups are added pairwise. A shard is read one histogram at a time and closed,
+ *    so the memory is about nThreadsMerge sets of histograms.
+ *  - trees are copied one shard at a time with fast cloning, the baskets are copied without decompression.
+ *  - other objects are copied from the first shard.
+ * With --weighted=1, the histograms of each shard are scaled by xsec / nEvents from its shard info (utilities/shardInfoUtil.h),
+ * ex. to merge samples generated in pthat bins. The shards must have unnormalized histograms, ex. qcdAna with --partialOutput=1,
+ * and the trees are not weighted. The shard info itself is summed without weight.
+ * Only the objects at the top directory of the shards are merged.
+ */
+void mergeShards(std::string outputFileName, std::string inputFileNames);
+void sumHistograms(const std::vector<std::string>& inputFiles, int iFirst, int iLast, bool weighted,
+                   std::map<std::string, TH1*>& sums, int& nErrors);
+void addHistograms(std::map<std::string, TH1*>& sums, std::map<std::string, TH1*>& other);
+void mergeTrees(const std::vector<std::string>& inputFiles, TFile* outputFile, std::string treeName, int& nErrors);
+bool isLatestCycle(TDirectory* dir, TKey* key);
+
+void mergeShards(std::string outputFileName, std::string inputFileNames)
+{
+    std::cout << "running mergeShards()" << std::endl;
+
+    std::cout << "##### Parameters #####" << std::endl;
+    std::cout << "outputFileName = " << outputFileName.c_str() << std::endl;
+    std::cout << "inputFileNames = " << inputFileNames.c_str() << std::endl;
+    std::cout << "##### Parameters - END #####" << std::endl;
+
+    int weighted = (ArgumentParser::ParseOptionInputSingle("--weighted", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--weighted", argOptions).c_str()) : 0;
+    int nThreadsMerge = (ArgumentParser::ParseOptionInputSingle("--nThreadsMerge", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nThreadsMerge", argOptions).c_str()) : 1;
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "weighted = " << weighted << std::endl;
+    std::cout << "nThreadsMerge = " << nThreadsMerge << std::endl;
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileNames);
+    int nFiles = inputFiles.size();
+    std::cout << "number of input files = " << nFiles << std::endl;
+    if (nFiles == 0) {
+        std::cout << "There are no input files. Exiting." << std::endl;
+        return;
+    }
+
+    // the histograms are owned by the threads, not by the files they are read from
+    TH1::AddDirectory(false);
+    ROOT::EnableThreadSafety();
+
+    int nThreads = std::max(1, std::min(nThreadsMerge, nFiles));
+    std::vector<std::map<std::string, TH1*> > sums(nThreads);
+    std::vector<int> nErrors(nThreads, 0);
+
+    std::cout << "Histograms STARTED" << std::endl;
+    std::vector<std::thread> threads;
+    for (int iThread = 0; iThread < nThreads; ++iThread) {
+        int iFirst = (long)nFiles * iThread / nThreads;
+        int iLast = (long)nFiles * (iThread + 1) / nThreads;
+        threads.push_back(std::thread(sumHistograms, std::cref(inputFiles), iFirst, iLast, (weighted > 0),
+                                      std::ref(sums[iThread]), std::ref(nErrors[iThread])));
+    }
+    for (int iThread = 0; iThread < nThreads; ++iThread) {
+        threads[iThread].join();
+    }
+
+    // pairwise reduction of the group sums, the result is in sums[0]
+    for (int stride = 1; stride < nThreads; stride *= 2) {
+        threads.clear();
+        for (int i = 0; i + stride < nThreads; i += 2 * stride) {
+            threads.push_back(std::thread(addHistograms, std::ref(sums[i]), std::ref(sums[i + stride])));
+        }
+        for (int i = 0; i < (int)threads.size(); ++i) {
+            threads[i].join();
+        }
+    }
+    std::cout << "Histograms ENDED" << std::endl;
+
+    int nErrorsTotal = 0;
+    for (int iThread = 0; iThread < nThreads; ++iThread) {
+        nErrorsTotal += nErrors[iThread];
+    }
+    if (nErrorsTotal > 0) {
+        std::cout << "ERROR : " << nErrorsTotal << " input files cannot be merged. Exiting." << std::endl;
+        return;
+    }
+
+    TFile* outputFile = TFile::Open(outputFileName.c_str(), "RECREATE");
+    outputFile->cd();
+    for (std::map<std::string, TH1*>::iterator it = sums[0].begin(); it != sums[0].end(); ++it) {
+        it->second->Write(it->first.c_str());
+        delete it->second;
+    }
+    std::cout << "number of histograms = " << sums[0].size() << std::endl;
+
+    // trees and other objects are taken from the first shard
+    std::vector<std::string> treeNames;
+    std::vector<std::string> otherNames;
+    TFile* firstFile = TFile::Open(inputFiles[0].c_str(), "READ");
+    TIter next(firstFile->GetListOfKeys());
+    TKey* key = 0;
+    while ((key = (TKey*)next())) {
+        if (!isLatestCycle(firstFile, key)) continue;
+
+        TClass* cl = TClass::GetClass(key->GetClassName());
+        if (cl == 0) continue;
+        if (cl->InheritsFrom(TH1::Class())) continue;
+
+        if (cl->InheritsFrom(TTree::Class())) {
+            treeNames.push_back(key->GetName());
+        }
+        else if (cl->InheritsFrom(TDirectory::Class())) {
+            std::cout << "WARNING : directory " << key->GetName() << " is not merged." << std::endl;
+        }
+        else if (std::string(key->GetClassName()).find("RNTuple") != std::string::npos) {
+            std::cout << "WARNING : RNTuple " << key->GetName() << " is not merged." << std::endl;
+        }
+        else {
+            otherNames.push_back(key->GetName());
+        }
+    }
+    for (int i = 0; i < (int)otherNames.size(); ++i) {
+        TObject* obj = firstFile->Get(otherNames[i].c_str());
+        outputFile->cd();
+        obj->Write(otherNames[i].c_str());
+    }
+    firstFile->Close();
+
+    int nTreeErrors = 0;
+    for (int i = 0; i < (int)treeNames.size(); ++i) {
+        std::cout << "merging tree " << treeNames[i].c_str() << std::endl;
+        mergeTrees(inputFiles, outputFile, treeNames[i], nTreeErrors);
+    }
+    std::cout << "number of trees = " << treeNames.size() << std::endl;
+    if (nTreeErrors > 0) {
+        std::cout << "ERROR : " << nTreeErrors << " trees are missing in the input files." << std::endl;
+    }
+
+    std::cout << "Closing the output file" << std::endl;
+    outputFile->Close();
+
+    std::cout << "running mergeShards() - END" << std::endl;
+}
+
+/*
+ * sums the histograms of input files [iFirst, iLast) into "sums", run in a thread per group of input files
+ */
+void sumHistograms(const std::vector<std::string>& inputFiles, int iFirst, int iLast, bool weighted,
+                   std::map<std::string, TH1*>& sums, int& nErrors)
+{
+    for (int i = iFirst; i < iLast; ++i) {
+
+        TFile* inputFile = TFile::Open(inputFiles[i].c_str(), "READ");
+        if (inputFile == 0 || inputFile->IsZombie()) {
+            std::cout << "ERROR : " << inputFiles[i].c_str() << " cannot be opened." << std::endl;
+            nErrors++;
+            continue;
+        }
+
+        double w = 1;
+        if (weighted) {
+            double xsec = 0;
+            double nEvents = 0;
+            if (!readShardInfo(inputFile, xsec, nEvents)) {
+                std::cout << "ERROR : " << inputFiles[i].c_str() << " has no shard info." << std::endl;
+                nErrors++;
+                inputFile->Close();
+                continue;
+            }
+            w = xsec / nEvents;
+        }
+
+        TIter next(inputFile->GetListOfKeys());
+        TKey* key = 0;
+        while ((key = (TKey*)next())) {
+            if (!isLatestCycle(inputFile, key)) continue;
+
+            TClass* cl = TClass::GetClass(key->GetClassName());
+            if (cl == 0 || !cl->InheritsFrom(TH1::Class())) continue;
+
+            std::string name = key->GetName();
+            TH1* h = (TH1*)key->ReadObj();
+            if (weighted && name != SHARDINFO::name) {
+                h->Scale(w);
+            }
+
+            std::map<std::string, TH1*>::iterator it = sums.find(name);
+            if (it == sums.end()) {
+                sums[name] = h;
+            }
+            else {
+                it->second->Add(h);
+                delete h;
+            }
+        }
+        inputFile->Close();
+    }
+}
+
+/*
+ * adds the histograms of "other" into "sums", the histograms of "other" are deleted
+ */
+void addHistograms(std::map<std::string, TH1*>& sums, std::map<std::string, TH1*>& other)
+{
+    for (std::map<std::string, TH1*>::iterator it = other.begin(); it != other.end(); ++it) {
+        std::map<std::string, TH1*>::iterator itSum = sums.find(it->first);
+        if (itSum == sums.end()) {
+            sums[it->first] = it->second;
+        }
+        else {
+            itSum->second->Add(it->second);
+            delete it->second;
+        }
+    }
+    other.clear();
+}
+
+/*
+ * copies the entries of tree "treeName" of each input file into "outputFile".
+ * Only one input file is open at a time and the baskets are written as they are copied.
+ */
+void mergeTrees(const std::vector<std::string>& inputFiles, TFile* outputFile, std::string treeName, int& nErrors)
+{
+    TTree* outputTree = 0;
+    for (int i = 0; i < (int)inputFiles.size(); ++i) {
+
+        TFile* inputFile = TFile::Open(inputFiles[i].c_str(), "READ");
+        TTree* inputTree = (inputFile != 0) ? (TTree*)inputFile->Get(treeName.c_str()) : 0;
+        if (inputTree == 0) {
+            std::cout << "ERROR : " << treeName.c_str() << " is not found in " << inputFiles[i].c_str() << std::endl;
+            nErrors++;
+            if (inputFile != 0) inputFile->Close();
+            continue;
+        }
+
+        if (outputTree == 0) {
+            outputFile->cd();
+            outputTree = inputTree->CloneTree(0);
+        }
+        // falls back to a copy entry by entry if the baskets cannot be cloned, ex. for different compression settings
+        outputTree->CopyEntries(inputTree, -1, "fast");
+
+        // the branch addresses of the clone are reset when the input tree is deleted
+        inputFile->Close();
+    }
+
+    if (outputTree != 0) {
+        outputFile->cd();
+        outputTree->Write("", TObject::kOverwrite);
+        delete outputTree;
+    }
+}
+
+/*
+ * returns true if "key" is the latest cycle of its object, the older cycles are backups written by AutoSave
+ */
+bool isLatestCycle(TDirectory* dir, TKey* key)
+{
+    return (dir->GetKey(key->GetName()) == key);
+}
+
+int main(int argc, char* argv[]) {
+
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 3) {
+        mergeShards(argStr.at(1), argStr.at(2));
+        return 0;
+    }
+    else {
+        std::cout << "Usage : \n" <<
+                "./mergeShards.exe <outputFileName> <inputFileNames> [options]"
+                << std::endl;
+        std::cout << "inputFileNames can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "--weighted=<1 to scale the histograms of each shard by xsec / nEvents of its shard info>" << std::endl;
+        std::cout << "--nThreadsMerge=<number of threads to sum the histograms>" << std::endl;
+        return 1;
+    }
+}
@@ -19,10 +19,9 @@
 #include "TApplication.h"
 #include "TLorentzVector.h"
 
-// dictionary to read Pythia8::Event
-#include "../dictionary/dict4RootDct.cc"
 #include "../utils/pythiaUtil.h"
 #include "../../fastjet3/fastJetTree.h"
+#include "../../utilities/storageUtil.h"
 #include "../../utilities/physicsUtil.h"
 
 #include <iostream>
@@ -64,8 +63,13 @@ void photonJetAna(std::string eventFileName, std::string jetFileName, std::strin
 
     TFile *jetFile = TFile::Open(jetFileName.c_str(),"READ");
     fastJetTree fjt;
-    TTree *jetTree = (TTree*)jetFile->Get(jetTreeName.c_str());
-    fjt.setupTreeForReading(jetTree);
+    // the jets can be either a TTree or an RNTuple
+    storageReader jetReader(jetFile, jetTreeName);
+    if (!jetReader.isValid()) {
+        std::cout << "Jet tree " << jetTreeName.c_str() << " cannot be read. Exiting." << std::endl;
+        return;
+    }
+    fjt.setupTreeForReading(jetReader);
 
     std::string akStr = "ak";
     std::string jetStr = "jets";
@@ -347,7 +351,7 @@ void photonJetAna(std::string eventFileName, std::string jetFileName, std::strin
 
     int eventsAnalyzed = 0;
     int nEvents = treeEvt->GetEntries();
-    int nEventsJets = jetTree->GetEntries();
+    int nEventsJets = jetReader.getEntries();
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "nEventsJets = " << nEventsJets << std::endl;
     if (nEvents != nEventsJets) {
@@ -364,7 +368,8 @@ void photonJetAna(std::string eventFileName, std::string jetFileName, std::strin
 
         treeEvt->GetEntry(iEvent);
         treeEvtParton->GetEntry(iEvent);
-        jetTree->GetEntry(iEvent);
+        jetReader.getEntry(iEvent);
+        fjt.decode();
 
         // jet analysis
         // particles from hard scattering are at index 5 and 6
@@ -18,8 +18,6 @@
 #include "TVirtualPad.h"
 #include "TApplication.h"
 
-// dictionary to read Pythia8::Event
-#include "../dictionary/dict4RootDct.cc"
 #include "../utils/pythiaUtil.h"
 #include "../../utilities/physicsUtil.h"
 #include "../../utilities/th1Util.h"
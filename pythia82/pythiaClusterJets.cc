@@ -12,22 +12,35 @@
 #include "TRandom3.h"
 #include "TLorentzVector.h"
 
-// dictionary to read Pythia8::Event
-#include "dictionary/dict4RootDct.cc"
 #include "utils/pythiaUtil.h"
+#include "utils/eventStore.h"
 #include "../fastjet3/fastJetTree.h"
+#include "../fastjet3/fastJetUtil.h"
 #include "../utilities/physicsUtil.h"
 #include "../utilities/systemUtil.h"
 #include "../utilities/particleTree.h"
+#include "../utilities/ArgumentParser.h"
+#include "../utilities/allocCounter.h"
+#include "../utilities/embeddingPool.h"
+#include "../utilities/toyEventUtil.h"
+#include "../utilities/cacheUtil.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/treeReadUtil.h"
+#include "../utilities/inputFilesUtil.h"
 
 #include "fastjet/ClusterSequence.hh"
+#include "fastjet/ClusterSequenceArea.hh"
 #include "fastjet/PseudoJet.hh"
+#include "fastjet/tools/GridMedianBackgroundEstimator.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <string>
 #include <vector>
 
+std::vector<std::string> argOptions;
+
 // types of particles to be used in jet clustering
 enum CONSTITUENTS {
     kFinal,         // final state particles (after hadronization)
@@ -43,6 +56,12 @@ enum CONSTITUENTS {
     kN_CONSTITUENTS
 };
 
+void fillPartonMatch(fastJetTree& fjt, Pythia8::Event* eventAll, Pythia8::Event* eventParton);
+void fillPythiaParticles(std::vector<fastjet::PseudoJet>& fjParticles, Pythia8::Event* event, Pythia8::Event* eventAll,
+                         int constituentType, Pythia8::ParticleData& particleData);
+void fillStoreParticles(std::vector<fastjet::PseudoJet>& fjParticles, const eventStoreReader& store, long long iEvent,
+                        int constituentType, Pythia8::ParticleData& particleData);
+void setJetTreeNameTitle(std::string& jetTreeName, std::string& jetTreeTitle, int dR, int constituentType);
 void pythiaClusterJets(std::string inputFileName = "pythiaEvents.root", std::string outputFileName = "pythiaClusterJets_out.root",
                        int dR = 3, int minJetPt = 5, int constituentType = 0, std::string jetptCSN = "0,0,0", std::string jetphiCSN = "0,0,0");
 
@@ -63,51 +82,243 @@ void pythiaClusterJets(std::string inputFileName, std::string outputFileName, in
     std::cout << "jetphiCSN = " << jetphiCSN.c_str() << std::endl;
     std::cout << "##### Parameters - END #####" << std::endl;
 
-    // Set up the ROOT TFile and TTree.
-    TFile* inputFile = TFile::Open(inputFileName.c_str(),"READ");
+    int writeConstituents = (ArgumentParser::ParseOptionInputSingle("--writeConstituents", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--writeConstituents", argOptions).c_str()) : 0;
+
+    int writePartonMatch = (ArgumentParser::ParseOptionInputSingle("--writePartonMatch", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--writePartonMatch", argOptions).c_str()) : 0;
+
+    // rho*A subtraction where rho is estimated with FastJet's GridMedianBackgroundEstimator
+    int subtractRho = (ArgumentParser::ParseOptionInputSingle("--subtractRho", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--subtractRho", argOptions).c_str()) : 0;
+    double rhoGridSpacing = (ArgumentParser::ParseOptionInputSingle("--rhoGridSpacing", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--rhoGridSpacing", argOptions).c_str()) : 0.55;
+    double rhoMaxRap = (ArgumentParser::ParseOptionInputSingle("--rhoMaxRap", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--rhoMaxRap", argOptions).c_str()) : 2.5;
+
+    // write WTA axis in addition to E-scheme axis, WTA axis is obtained from the constituents of each jet
+    int writeWTAAxis = (ArgumentParser::ParseOptionInputSingle("--writeWTAAxis", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--writeWTAAxis", argOptions).c_str()) : 0;
+
+    // substructure observables : constituent count, pTD, angularities and soft drop zg, Rg
+    int writeSubstructure = (ArgumentParser::ParseOptionInputSingle("--writeSubstructure", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--writeSubstructure", argOptions).c_str()) : 0;
+    double sdZcut = (ArgumentParser::ParseOptionInputSingle("--sdZcut", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--sdZcut", argOptions).c_str()) : 0.1;
+    double sdBeta = (ArgumentParser::ParseOptionInputSingle("--sdBeta", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--sdBeta", argOptions).c_str()) : 0;
+
+    // pool of background events for MIX types, used instead of the entry-aligned evtHydjet tree of the input file
+    // the pool is loaded from a particleTree in mixPoolFile or generated as thermal events if mixPoolThermalMult is set
+    std::string mixPoolFile = (ArgumentParser::ParseOptionInputSingle("--mixPoolFile", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mixPoolFile", argOptions) : "NULL";
+    std::string mixPoolTree = (ArgumentParser::ParseOptionInputSingle("--mixPoolTree", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mixPoolTree", argOptions) : "evtHydjet";
+    std::string mixPoolThermalMult = (ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMult", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMult", argOptions) : "NULL";
+    double mixPoolThermalMeanPt = (ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMeanPt", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMeanPt", argOptions).c_str()) : 0.65;
+    double mixPoolThermalMaxEta = (ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMaxEta", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--mixPoolThermalMaxEta", argOptions).c_str()) : 3;
+    int mixPoolSize = (ArgumentParser::ParseOptionInputSingle("--mixPoolSize", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--mixPoolSize", argOptions).c_str()) : 1000;
+    int mixPoolSeed = (ArgumentParser::ParseOptionInputSingle("--mixPoolSeed", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--mixPoolSeed", argOptions).c_str()) : 24680;
+    int mixPoolRotatePhi = (ArgumentParser::ParseOptionInputSingle("--mixPoolRotatePhi", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--mixPoolRotatePhi", argOptions).c_str()) : 1;
+
+    // cluster also the particles of a second constituent type and match the jets of the two types
+    // ex. constituentType = kFinal and matchConstituentType = kFinalCh for charged jet - full jet matching
+    int matchConstituentType = (ArgumentParser::ParseOptionInputSingle("--matchConstituentType", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--matchConstituentType", argOptions).c_str()) : -1;
+    double matchMaxDR = (ArgumentParser::ParseOptionInputSingle("--matchMaxDR", argOptions).size() > 0) ?
+            std::atof(ArgumentParser::ParseOptionInputSingle("--matchMaxDR", argOptions).c_str()) : jetRadius;
+
+    // cluster even if the output file has the jet trees from a job with the same inputs
+    int noCache = (ArgumentParser::ParseOptionInputSingle("--noCache", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--noCache", argOptions).c_str()) : 0;
+
+    // layout of the output trees : 0 for vector branches, otherwise C arrays with space for this many entries
+    int flatLayout = (ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).c_str()) : 0;
+
+    // jet kinematics with truncated mantissas if > 0, see utilities/precisionUtil.h
+    int reducedPrecision = (ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).c_str()) : 0;
+
+    // directory of the event stores written by convertEventStore, the events are read from the stores instead of the trees
+    std::string eventStore = (ArgumentParser::ParseOptionInputSingle("--eventStore", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--eventStore", argOptions) : "NULL";
+
+    // backend of the jet outputs : TTree or RNTuple
+    std::string storage = (ArgumentParser::ParseOptionInputSingle("--storage", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--storage", argOptions) : STORAGE::BACKENDNAMES[STORAGE::kTTree];
+
+    // number of input files processed concurrently, each file in a separate process
+    int nParallel = (ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nParallel", argOptions).c_str()) : 1;
+
+    // entry number of the first input event in the job over all input files, set for the partial jobs of --nParallel.
+    // The random numbers are keyed on the entry number in the job over all files, so the output does not depend on nParallel.
+    long long entryOffset = (ArgumentParser::ParseOptionInputSingle("--entryOffset", argOptions).size() > 0) ?
+            std::atoll(ArgumentParser::ParseOptionInputSingle("--entryOffset", argOptions).c_str()) : 0;
+
+    // set for the partial jobs of --nParallel, they have no cache key. The key of the merged output is written by the main job.
+    int partialOutput = (ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--partialOutput", argOptions).c_str()) : 0;
+
+    // clustering strategy, "auto" chooses the strategy per event from the number of input particles
+    std::string strategy = (ArgumentParser::ParseOptionInputSingle("--strategy", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--strategy", argOptions) : FASTJETUTIL::STRATEGYNAMES[FASTJETUTIL::kBest];
+
+    treeReadSetup readSetup;
+    readSetup.parseOptions(argOptions);
+
+    std::cout << "##### Optional Arguments #####" << std::endl;
+    std::cout << "writeConstituents = " << writeConstituents << std::endl;
+    std::cout << "writePartonMatch = " << writePartonMatch << std::endl;
+    std::cout << "subtractRho = " << subtractRho << std::endl;
+    std::cout << "rhoGridSpacing = " << rhoGridSpacing << std::endl;
+    std::cout << "rhoMaxRap = " << rhoMaxRap << std::endl;
+    std::cout << "writeWTAAxis = " << writeWTAAxis << std::endl;
+    std::cout << "writeSubstructure = " << writeSubstructure << std::endl;
+    std::cout << "sdZcut = " << sdZcut << std::endl;
+    std::cout << "sdBeta = " << sdBeta << std::endl;
+    std::cout << "mixPoolFile = " << mixPoolFile.c_str() << std::endl;
+    std::cout << "mixPoolTree = " << mixPoolTree.c_str() << std::endl;
+    std::cout << "mixPoolThermalMult = " << mixPoolThermalMult.c_str() << std::endl;
+    std::cout << "mixPoolThermalMeanPt = " << mixPoolThermalMeanPt << std::endl;
+    std::cout << "mixPoolThermalMaxEta = " << mixPoolThermalMaxEta << std::endl;
+    std::cout << "mixPoolSize = " << mixPoolSize << std::endl;
+    std::cout << "mixPoolSeed = " << mixPoolSeed << std::endl;
+    std::cout << "mixPoolRotatePhi = " << mixPoolRotatePhi << std::endl;
+    std::cout << "matchConstituentType = " << matchConstituentType << std::endl;
+    std::cout << "matchMaxDR = " << matchMaxDR << std::endl;
+    std::cout << "noCache = " << noCache << std::endl;
+    std::cout << "flatLayout = " << flatLayout << std::endl;
+    std::cout << "reducedPrecision = " << reducedPrecision << std::endl;
+    std::cout << "storage = " << storage.c_str() << std::endl;
+    std::cout << "eventStore = " << eventStore.c_str() << std::endl;
+    std::cout << "strategy = " << strategy.c_str() << std::endl;
+    std::cout << "nParallel = " << nParallel << std::endl;
+    std::cout << "entryOffset = " << entryOffset << std::endl;
+    std::cout << "partialOutput = " << partialOutput << std::endl;
+    readSetup.printOptions();
+    std::cout << "##### Optional Arguments - END #####" << std::endl;
+
+    int iStrategy = getStrategyIndex(strategy);
+    if (iStrategy < 0) {
+        std::cout << "Strategy : " << strategy.c_str() << " is not recognized as a valid strategy. Exiting." << std::endl;
+        return;
+    }
+
+    int iStorage = getStorageBackendIndex(storage);
+    if (iStorage < 0) {
+        std::cout << "Storage : " << storage.c_str() << " is not recognized as a valid storage backend. Exiting." << std::endl;
+        return;
+    }
+
+    // the second constituent type is clustered from the Pythia event only
+    bool doMatch = (matchConstituentType >= 0);
+    if (doMatch && !(matchConstituentType == CONSTITUENTS::kFinal || matchConstituentType == CONSTITUENTS::kFinalCh
+                     || matchConstituentType == CONSTITUENTS::kParton || matchConstituentType == CONSTITUENTS::kPartonHard
+                     || matchConstituentType == CONSTITUENTS::kFinal_WTA)) {
+        std::cout << "matchConstituentType : " << matchConstituentType << " is not a valid type for matching. Exiting." << std::endl;
+        return;
+    }
+    if (doMatch && matchConstituentType == constituentType) {
+        std::cout << "matchConstituentType is the same as constituentType. Exiting." << std::endl;
+        return;
+    }
+
+    // the input can be a list of files, it is read as TChains
+    std::vector<std::string> inputFiles = expandInputFiles(inputFileName);
+    std::cout << "number of input files = " << inputFiles.size() << std::endl;
+
+    // with nParallel, this job checks the cache over all input files, then forks the partial jobs and merges their outputs.
+    // The event store is a single directory for all input files, it is not split.
+    bool runPartials = (nParallel > 1 && inputFiles.size() > 1 && eventStore == "NULL");
+    // the reading threads are started by the partial jobs, not before the fork
+    if (!runPartials) {
+        readSetup.init();
+    }
+
+    // Set up the ROOT TChain.
     Pythia8::Event* eventAll = 0;
 
     std::string evtTreePath = "evt";
-    TTree* treeEvt = (TTree*)inputFile->Get(evtTreePath.c_str());
-    treeEvt->SetBranchAddress("event", &eventAll);
+    TTree* treeEvt = 0;
 
     Pythia8::Event* eventParton = 0;
     std::string evtPartonTreePath = "evtParton";
-    TTree* treeEvtParton = (TTree*)inputFile->Get(evtPartonTreePath.c_str());
-    treeEvtParton->SetBranchAddress("event", &eventParton);
+    TTree* treeEvtParton = 0;
+
+    bool useEventStore = (eventStore != "NULL");
+    eventStoreReader storeEvt;
+    eventStoreReader storeEvtParton;
+    if (useEventStore) {
+        if (!storeEvt.open(eventStore + "/" + evtTreePath) || !storeEvtParton.open(eventStore + "/" + evtPartonTreePath)) {
+            std::cout << "Event store " << eventStore.c_str() << " cannot be read. Exiting." << std::endl;
+            return;
+        }
+        eventAll = new Pythia8::Event();
+        eventParton = new Pythia8::Event();
+    }
+    else {
+        treeEvt = openChain(inputFiles, evtTreePath);
+        treeEvtParton = openChain(inputFiles, evtPartonTreePath);
+        if (treeEvt == 0 || treeEvtParton == 0) {
+            std::cout << "Event trees cannot be read. Exiting." << std::endl;
+            return;
+        }
+        treeEvt->SetBranchAddress("event", &eventAll);
+        treeEvtParton->SetBranchAddress("event", &eventParton);
+        readSetup.add("evt", treeEvt);
+        readSetup.add("evtParton", treeEvtParton);
+    }
 
     Pythia8::Event* event = eventAll;
 
-    bool useFinalParticles = (constituentType == CONSTITUENTS::kFinal
-            || constituentType == CONSTITUENTS::kFinalCh
-            || constituentType == CONSTITUENTS::kFinal_AND_MIX
-            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX
-            || constituentType == CONSTITUENTS::kFinal_WTA
-            || constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA);
-    bool useFinalChParticles = useFinalParticles && (constituentType == CONSTITUENTS::kFinalCh
-            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX);
     bool usePartons = (constituentType == CONSTITUENTS::kParton || constituentType == CONSTITUENTS::kPartonHard);
     if (usePartons) {
         event = eventParton;
     }
 
     particleTree mixEvtParticles;
+    particleTree* mixEvt = &mixEvtParticles;
     TTree* treeMixEvt = 0;
     bool doOnlyMixEvt = (constituentType == CONSTITUENTS::kMIX || constituentType == CONSTITUENTS::kMIX_WTA);
     bool doMixEvt = (constituentType == CONSTITUENTS::kFinal_AND_MIX || constituentType == CONSTITUENTS::kFinalCh_AND_MIX
                                                                      || constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA
                                                                      || doOnlyMixEvt);
 
-    if (doMixEvt) {
+    // there are no hard scattering partons in a mixed event
+    if (doOnlyMixEvt) {
+        writePartonMatch = 0;
+    }
+
+    // the pool is filled after the cache check
+    embeddingPool mixPool(mixPoolSeed, (mixPoolRotatePhi > 0));
+    bool useMixPool = doMixEvt && (mixPoolFile != "NULL" || mixPoolThermalMult != "NULL");
+    if (!useMixPool && doMixEvt) {
         std::string mixEvtTreePath = "evtHydjet";
-        treeMixEvt = (TTree*)inputFile->Get(mixEvtTreePath.c_str());
+        treeMixEvt = openChain(inputFiles, mixEvtTreePath);
+        if (treeMixEvt == 0) {
+            std::cout << "MIX event tree cannot be read. Exiting." << std::endl;
+            return;
+        }
         mixEvtParticles.setupTreeForReading(treeMixEvt);
+        readSetup.add("mixEvt", treeMixEvt);
     }
 
     std::cout << "initialize the Pythia class to obtain info that is not accessible through event TTree." << std::endl;
     std::cout << "##### Pythia initialize #####" << std::endl;
     Pythia8::Pythia pythia;
     std::cout << "##### Pythia initialize - END #####" << std::endl;
+    if (useEventStore) {
+        eventAll->init("Event record read from the event store", &pythia.particleData);
+        eventParton->init("Parton level event record read from the event store", &pythia.particleData);
+    }
 
     TFile* outputFile = new TFile(outputFileName.c_str(), "UPDATE");
 
@@ -116,217 +327,537 @@ void pythiaClusterJets(std::string inputFileName, std::string outputFileName, in
                                                     || constituentType == CONSTITUENTS::kMIX_WTA) {
         recombScheme = fastjet::WTA_pt_scheme;
     }
+    // jet axis is already WTA
+    if (recombScheme == fastjet::WTA_pt_scheme) {
+        writeWTAAxis = 0;
+    }
 
     fastjet::JetDefinition* fjJetDefn = 0;
     fjJetDefn = new fastjet::JetDefinition(fastjet::antikt_algorithm, jetRadius);
     fjJetDefn->set_recombination_scheme((fastjet::RecombinationScheme)recombScheme);
-
-    std::string jetTreeName = Form("ak%djets", dR);
-    std::string jetTreeTitle = Form("jets with R = %.1f", jetRadius);
-    if (constituentType == CONSTITUENTS::kFinalCh) {
-        jetTreeName = Form("ak%djetsCh", dR);
-        jetTreeTitle = Form("charged particle jets with R = %.1f", jetRadius);
-    }
-    else if (constituentType == CONSTITUENTS::kParton) {
-        jetTreeName = Form("ak%djetsParton", dR);
-        jetTreeTitle = Form("partonic jets with R = %.1f", jetRadius);
-    }
-    else if (constituentType == CONSTITUENTS::kPartonHard) {
-        jetTreeName = Form("ak%djetsPartonHard", dR);
-        jetTreeTitle = Form("partonic jets from hard scattering with R = %.1f", jetRadius);
-    }
-    else if (constituentType == CONSTITUENTS::kFinal_AND_MIX) {
-        jetTreeName = Form("ak%djetsMixed", dR);
-        jetTreeTitle = Form("jets with R = %.1f from Pythia+MIX event", jetRadius);
+    jetDefinitionSelector fjJetDefnSelector(*fjJetDefn, iStrategy);
+
+    fastjet::JetDefinition fjJetDefnMatch(fastjet::antikt_algorithm, jetRadius,
+            (matchConstituentType == CONSTITUENTS::kFinal_WTA) ? fastjet::WTA_pt_scheme : fastjet::E_scheme);
+    jetDefinitionSelector fjJetDefnMatchSelector(fjJetDefnMatch, iStrategy);
+
+    std::string jetTreeName;
+    std::string jetTreeTitle;
+    setJetTreeNameTitle(jetTreeName, jetTreeTitle, dR, constituentType);
+
+    // semicolon separated list of smearing variants, each variant is a comma separated list for CSN parameters
+    // ex. jetptCSN = "0.06,0.95,0;0.06,1.2,0" writes two smeared trees from the same clustered jets.
+    // A list with a single variant is used for all variants of the other list.
+    std::vector<std::string> jetptCSNVariants = split(jetptCSN, ";");
+    std::vector<std::string> jetphiCSNVariants = split(jetphiCSN, ";");
+    int nVariants = std::max(jetptCSNVariants.size(), jetphiCSNVariants.size());
+    if (((int)jetptCSNVariants.size() > 1 && (int)jetptCSNVariants.size() != nVariants) ||
+        ((int)jetphiCSNVariants.size() > 1 && (int)jetphiCSNVariants.size() != nVariants)) {
+        std::cout << "ERROR : jetptCSN and jetphiCSN have different number of variants." << std::endl;
+        std::cout << "jetptCSN = " << jetptCSN.c_str() << std::endl;
+        std::cout << "jetphiCSN = " << jetphiCSN.c_str() << std::endl;
+        std::cout << "Exiting" << std::endl;
+        return;
     }
-    else if (constituentType == CONSTITUENTS::kFinalCh_AND_MIX) {
-        jetTreeName = Form("ak%djetsChMixed", dR);
-        jetTreeTitle = Form("charged particle jets with R = %.1f from Pythia+MIX event", jetRadius);
+    std::cout << "number of smearing variants = " << nVariants << std::endl;
+
+    std::vector<std::vector<double> > csnPts(nVariants);
+    std::vector<std::vector<double> > csnPhis(nVariants);
+    std::vector<bool> smearJetPts(nVariants, false);
+    std::vector<bool> smearJetPhis(nVariants, false);
+    std::vector<std::string> jetTreeNames(nVariants, jetTreeName);
+    std::vector<std::string> jetTreeTitles(nVariants, jetTreeTitle);
+    for (int iVar = 0; iVar < nVariants; ++iVar) {
+
+        std::vector<std::string> csnStr;
+
+        // energy smearing
+        csnStr = split(jetptCSNVariants[((int)jetptCSNVariants.size() > 1) ? iVar : 0], ",");
+        for (int i = 0; i < (int)csnStr.size(); ++i) {
+            double val = std::atof(csnStr.at(i).c_str());
+            csnPts[iVar].push_back(val);
+            if (val > 0) smearJetPts[iVar] = true;
+        }
+        if ((int)csnPts[iVar].size() != 3) smearJetPts[iVar] = false;
+
+        // angle smearing
+        csnStr = split(jetphiCSNVariants[((int)jetphiCSNVariants.size() > 1) ? iVar : 0], ",");
+        for (int i = 0; i < (int)csnStr.size(); ++i) {
+            double val = std::atof(csnStr.at(i).c_str());
+            csnPhis[iVar].push_back(val);
+            if (val > 0) smearJetPhis[iVar] = true;
+        }
+        if ((int)csnPhis[iVar].size() != 3) smearJetPhis[iVar] = false;
+
+        // apply smearing if any of the C, S, N is > 0.
+        if (smearJetPts[iVar] || smearJetPhis[iVar])  {
+            jetTreeNames[iVar].append("Smeared");
+            if (nVariants > 1)  jetTreeNames[iVar].append(Form("%d", iVar));
+            if (smearJetPts[iVar])  jetTreeTitles[iVar].append(Form(", pt smeared with C = %.2f, S = %.2f, N = %.2f",
+                                                                    csnPts[iVar].at(0), csnPts[iVar].at(1), csnPts[iVar].at(2)));
+            if (smearJetPhis[iVar])  jetTreeTitles[iVar].append(Form(", phi smeared with C = %.2f, S = %.2f, N = %.2f",
+                                                                     csnPhis[iVar].at(0), csnPhis[iVar].at(1), csnPhis[iVar].at(2)));
+        }
+
+        std::cout << "jetTreeName = " << jetTreeNames[iVar].c_str() << std::endl;
+        std::cout << "jetTreeTitle = " << jetTreeTitles[iVar].c_str() << std::endl;
     }
-    else if (constituentType == CONSTITUENTS::kFinal_WTA) {
-        jetTreeName = Form("ak%djetsWTA", dR);
-        jetTreeTitle = Form("jets with R = %.1f, WTA", jetRadius);
+    // the unsmeared variants have the name of the unsmeared tree, so there can be only one of them
+    if (vectorUnique(jetTreeNames).size() != jetTreeNames.size()) {
+        std::cout << "ERROR : more than one smearing variant is unsmeared, their jet trees would have the same name." << std::endl;
+        std::cout << "jetptCSN = " << jetptCSN.c_str() << std::endl;
+        std::cout << "jetphiCSN = " << jetphiCSN.c_str() << std::endl;
+        std::cout << "Exiting" << std::endl;
+        return;
     }
-    else if (constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA) {
-        jetTreeName = Form("ak%djetsWTAMixed", dR);
-        jetTreeTitle = Form("jets with R = %.1f, WTA, from Pythia+MIX event", jetRadius);
+
+    // all trees written by the job, the cache is used only if the output has all of them
+    std::string jetMatchTreeName;
+    std::string jetMatchTreeTitle;
+    if (doMatch) {
+        setJetTreeNameTitle(jetMatchTreeName, jetMatchTreeTitle, dR, matchConstituentType);
+        // the name is different from the tree written by a separate job for matchConstituentType
+        jetMatchTreeName = Form("%sMatchTo%s", jetMatchTreeName.c_str(), jetTreeNames[0].c_str());
+        jetMatchTreeTitle.append(Form(", matched to %s", jetTreeNames[0].c_str()));
     }
-    else if (constituentType == CONSTITUENTS::kMIX) {
-        jetTreeName = Form("ak%djetsOnlyMixed", dR);
-        jetTreeTitle = Form("jets with R = %.1f from MIX event", jetRadius);
+    std::vector<std::string> outputTreeNames;
+    for (int iVar = 0; iVar < nVariants; ++iVar) {
+        outputTreeNames.push_back(jetTreeNames[iVar]);
+        if (doMixEvt && !doOnlyMixEvt)  outputTreeNames.push_back(Form("%sMixSub", jetTreeNames[iVar].c_str()));
+        if (subtractRho > 0)  outputTreeNames.push_back(Form("%sRhoSub", jetTreeNames[iVar].c_str()));
     }
-    else if (constituentType == CONSTITUENTS::kMIX_WTA) {
-        jetTreeName = Form("ak%djetsWTAOnlyMixed", dR);
-        jetTreeTitle = Form("jets with R = %.1f, WTA, from MIX event", jetRadius);
+    if (doMatch)  outputTreeNames.push_back(jetMatchTreeName);
+
+    // key of the cache : checksums of the inputs and of the executable, the jet definition and all parameters
+    // the checksums of the inputs are memoized in the output file, they are recomputed only for modified inputs
+    std::string cacheKey = "";
+    std::string cacheKeyName = Form("%sCacheKey", jetTreeNames[0].c_str());
+    if (partialOutput == 0) {
+        std::vector<std::string> cacheKeyOptions;
+        for (int i = 0; i < (int)argOptions.size(); ++i) {
+            if (argOptions[i].find("--noCache") == 0) continue;
+            // the output does not depend on the number of partial jobs
+            if (argOptions[i].find("--nParallel") == 0) continue;
+            // the read setup does not change the output
+            if (argOptions[i].find("--cacheSizeMB") == 0) continue;
+            if (argOptions[i].find("--asyncPrefetch") == 0) continue;
+            if (argOptions[i].find("--nThreadsRead") == 0) continue;
+            cacheKeyOptions.push_back(argOptions[i]);
+        }
+        std::sort(cacheKeyOptions.begin(), cacheKeyOptions.end());
+        std::string inputMD5 = "";
+        for (int i = 0; i < (int)inputFiles.size(); ++i) {
+            if (i > 0) inputMD5.append(",");
+            inputMD5.append(getFileMD5(inputFiles[i], outputFile));
+        }
+        cacheKey = Form("input=%s;jetDefinition=%s;minJetPt=%d;constituentType=%d;jetptCSN=%s;jetphiCSN=%s",
+                        inputMD5.c_str(), fjJetDefn->description().c_str(), minJetPt,
+                        constituentType, jetptCSN.c_str(), jetphiCSN.c_str());
+        if (useMixPool && mixPoolFile != "NULL") {
+            cacheKey.append(Form(";mixPoolFile=%s", getFileMD5(mixPoolFile, outputFile).c_str()));
+        }
+        for (int i = 0; i < (int)cacheKeyOptions.size(); ++i) {
+            cacheKey.append(Form(";%s", cacheKeyOptions[i].c_str()));
+        }
+        cacheKey.append(Form(";exe=%s", getExecutableMD5().c_str()));
+        std::cout << "cacheKey = " << cacheKey.c_str() << std::endl;
     }
-    // comma separated list for CSN parameters
-    std::vector<double> csnPt;
-    std::vector<std::string> csnStr;
 
-    // energy smearing
-    csnStr = split(jetptCSN, ",");
-    bool smearJetPt = false;
-    for (int i = 0; i < csnStr.size(); ++i) {
-        double val = std::atof(csnStr.at(i).c_str());
-        csnPt.push_back(val);
-        smearJetPt |= (val > 0);
+    if (partialOutput == 0 && noCache == 0 && isCached(outputFile, cacheKeyName, cacheKey, outputTreeNames)) {
+        std::cout << "Output file has the jet trees from a job with the same inputs. Clustering is skipped." << std::endl;
+        delete treeEvt;
+        delete treeEvtParton;
+        delete treeMixEvt;
+        outputFile->Close();
+        std::cout << "running pythiaClusterJets() - END" << std::endl;
+        return;
     }
-    smearJetPt &= ((int)csnPt.size() == 3);
 
-    // angle smearing
-    std::vector<double> csnPhi;
-    csnStr = split(jetphiCSN, ",");
-    bool smearJetPhi = false;
-    for (int i = 0; i < csnStr.size(); ++i) {
-        double val = std::atof(csnStr.at(i).c_str());
-        csnPhi.push_back(val);
-        smearJetPhi |= (val > 0);
+    if (runPartials) {
+        delete treeEvt;
+        delete treeEvtParton;
+        delete treeMixEvt;
+        outputFile->Close();
+
+        std::vector<Long64_t> entryOffsets = getEntryOffsets(inputFiles, evtTreePath);
+        if (entryOffsets.size() != inputFiles.size()) {
+            std::cout << "Event trees cannot be read. Exiting." << std::endl;
+            return;
+        }
+
+        // the jet trees of the partial jobs are merged into the output, replacing the trees with the same name
+        bool jobsOK = runPartialJobs(inputFiles.size(), nParallel, outputFileName, outputFileName, true,
+                [&](int iFile, std::string partialFileName) {
+                    setOption(argOptions, "--nParallel", "1");
+                    setOption(argOptions, "--partialOutput", "1");
+                    setOption(argOptions, "--entryOffset", Form("%lld", entryOffsets[iFile]));
+                    pythiaClusterJets(inputFiles[iFile], partialFileName, dR, minJetPt, constituentType, jetptCSN, jetphiCSN);
+                });
+        if (!jobsOK) {
+            std::cout << "Partial jobs failed. Exiting." << std::endl;
+            return;
+        }
+
+        // the key of the merged output replaces the keys of the partial jobs
+        outputFile = TFile::Open(outputFileName.c_str(), "UPDATE");
+        writeCacheKey(outputFile, cacheKeyName, cacheKey);
+        outputFile->Close();
+
+        std::cout << "running pythiaClusterJets() - END" << std::endl;
+        return;
     }
-    smearJetPhi &= ((int)csnPhi.size() == 3);
 
-    // apply smearing if any of the C, S, N is > 0.
-    if (smearJetPt || smearJetPhi)  {
-        jetTreeName.append("Smeared");
-        if (smearJetPt)  jetTreeTitle.append(Form(", pt smeared with C = %.2f, S = %.2f, N = %.2f", csnPt.at(0), csnPt.at(1), csnPt.at(2)));
-        if (smearJetPhi)  jetTreeTitle.append(Form(", phi smeared with C = %.2f, S = %.2f, N = %.2f", csnPhi.at(0), csnPhi.at(1), csnPhi.at(2)));
+    if (useMixPool) {
+        if (mixPoolThermalMult != "NULL") {
+            std::vector<std::string> multStr = split(mixPoolThermalMult, ",");
+            int minMultCh = std::atoi(multStr.at(0).c_str());
+            int maxMultCh = (multStr.size() > 1) ? std::atoi(multStr.at(1).c_str()) : minMultCh;
+            thermalEventSampler thermalSampler(minMultCh, maxMultCh, mixPoolThermalMeanPt, mixPoolThermalMaxEta);
+            mixPool.generate(thermalSampler, mixPoolSize, mixPoolSeed);
+        }
+        else {
+            TFile* mixPoolInputFile = TFile::Open(mixPoolFile.c_str(),"READ");
+            TTree* treeMixPool = (mixPoolInputFile != 0 && !mixPoolInputFile->IsZombie()) ?
+                    (TTree*)mixPoolInputFile->Get(mixPoolTree.c_str()) : 0;
+            if (treeMixPool == 0) {
+                std::cout << "MIX pool tree " << mixPoolTree.c_str() << " cannot be read from " << mixPoolFile.c_str() << ". Exiting." << std::endl;
+                if (mixPoolInputFile != 0) mixPoolInputFile->Close();
+                delete treeEvt;
+                delete treeEvtParton;
+                outputFile->Close();
+                return;
+            }
+            mixPool.load(treeMixPool, mixPoolSize);
+            mixPoolInputFile->Close();
+        }
+        std::cout << "number of events in the MIX pool = " << mixPool.size() << std::endl;
     }
 
-    std::cout << "jetTreeName = " << jetTreeName.c_str() << std::endl;
-    std::cout << "jetTreeTitle = " << jetTreeTitle.c_str() << std::endl;
+    // one set of trees per smearing variant
+    // the vectors are not resized after the branches are created, so that the branch addresses stay valid.
+    std::vector<storageWriter*> jetTrees(nVariants, 0);
+    std::vector<fastJetTree> fjts(nVariants);
+    std::vector<storageWriter*> jetMixSubTrees(nVariants, 0);
+    std::vector<fastJetTree> fjtsMixSub(nVariants);
+    std::vector<storageWriter*> jetRhoSubTrees(nVariants, 0);
+    std::vector<fastJetTree> fjtsRhoSub(nVariants);
+    for (int iVar = 0; iVar < nVariants; ++iVar) {
+
+        fjts[iVar].setFlatLayout(flatLayout);
+        fjtsMixSub[iVar].setFlatLayout(flatLayout);
+        fjtsRhoSub[iVar].setFlatLayout(flatLayout);
+        fjts[iVar].setReducedPrecision(reducedPrecision);
+        fjtsMixSub[iVar].setReducedPrecision(reducedPrecision);
+        fjtsRhoSub[iVar].setReducedPrecision(reducedPrecision);
+
+        jetTrees[iVar] = new storageWriter(outputFile, jetTreeNames[iVar], jetTreeTitles[iVar], iStorage);
+        fjts[iVar].branchTree(*jetTrees[iVar]);
+        if (writeConstituents > 0) {
+            fjts[iVar].branchTreeConstituents(*jetTrees[iVar]);
+        }
+        if (writePartonMatch > 0) {
+            fjts[iVar].branchTreeParton(*jetTrees[iVar]);
+        }
+        if (writeWTAAxis > 0) {
+            fjts[iVar].branchTreeWTA(*jetTrees[iVar]);
+        }
+        if (writeSubstructure > 0) {
+            fjts[iVar].branchTreeSubstructure(*jetTrees[iVar]);
+        }
+
+        if (doMixEvt && !doOnlyMixEvt) {
+            std::string jetMixSubTreeName = Form("%sMixSub", jetTreeNames[iVar].c_str());
+            std::string jetMixSubTreeTitle = Form("%s - Energy from Mix event subtracted", jetTreeTitles[iVar].c_str());
+            jetMixSubTrees[iVar] = new storageWriter(outputFile, jetMixSubTreeName, jetMixSubTreeTitle, iStorage);
+            fjtsMixSub[iVar].branchTree(*jetMixSubTrees[iVar]);
+            if (writeConstituents > 0) {
+                fjtsMixSub[iVar].branchTreeConstituents(*jetMixSubTrees[iVar]);
+            }
+            if (writePartonMatch > 0) {
+                fjtsMixSub[iVar].branchTreeParton(*jetMixSubTrees[iVar]);
+            }
+        }
 
-    TTree* jetTree = new TTree(jetTreeName.c_str(), jetTreeTitle.c_str());
-    fastJetTree fjt;
-    fjt.branchTree(jetTree);
+        if (subtractRho > 0) {
+            std::string jetRhoSubTreeName = Form("%sRhoSub", jetTreeNames[iVar].c_str());
+            std::string jetRhoSubTreeTitle = Form("%s - rho*A subtracted, rho from grid median", jetTreeTitles[iVar].c_str());
+            jetRhoSubTrees[iVar] = new storageWriter(outputFile, jetRhoSubTreeName, jetRhoSubTreeTitle, iStorage);
+            fjtsRhoSub[iVar].branchTree(*jetRhoSubTrees[iVar]);
+            fjtsRhoSub[iVar].branchTreeRho(*jetRhoSubTrees[iVar]);
+            if (writeConstituents > 0) {
+                fjtsRhoSub[iVar].branchTreeConstituents(*jetRhoSubTrees[iVar]);
+            }
+            if (writePartonMatch > 0) {
+                fjtsRhoSub[iVar].branchTreeParton(*jetRhoSubTrees[iVar]);
+            }
+        }
+    }
 
-    TTree* jetMixSubTree = 0;
-    fastJetTree fjtMixSub;
-    if (doMixEvt && !doOnlyMixEvt) {
-        std::string jetMixSubTreeName = Form("%sMixSub", jetTreeName.c_str());
-        std::string jetMixSubTreeTitle = Form("%s - Energy from Mix event subtracted", jetTreeTitle.c_str());
-        jetMixSubTree = new TTree(jetMixSubTreeName.c_str(), jetMixSubTreeTitle.c_str());
-        fjtMixSub.branchTree(jetMixSubTree);
+    // jets of the second constituent type, they are not smeared
+    storageWriter* jetMatchTree = 0;
+    fastJetTree fjtMatch;
+    if (doMatch) {
+        std::cout << "jetMatchTreeName = " << jetMatchTreeName.c_str() << std::endl;
+        std::cout << "jetMatchTreeTitle = " << jetMatchTreeTitle.c_str() << std::endl;
+
+        jetMatchTree = new storageWriter(outputFile, jetMatchTreeName, jetMatchTreeTitle, iStorage);
+        fjtMatch.setFlatLayout(flatLayout);
+        fjtMatch.setReducedPrecision(reducedPrecision);
+        fjtMatch.branchTree(*jetMatchTree);
+        fjtMatch.branchTreeMatch(*jetMatchTree);
+        for (int iVar = 0; iVar < nVariants; ++iVar) {
+            fjts[iVar].branchTreeMatch(*jetTrees[iVar]);
+        }
     }
 
+    // Median of pt/area in a grid of eta-phi tiles, it does not cluster ghost particles.
+    fastjet::GridMedianBackgroundEstimator bkgEstimator(rhoMaxRap, rhoGridSpacing);
+    // Voronoi areas are calculated from the particles, no ghosts are added
+    fastjet::AreaDefinition areaDefn(fastjet::VoronoiAreaSpec(1.0));
+
     // Fastjet input
     std::vector<fastjet::PseudoJet> fjParticles;
+    pseudoJetConverter fjConverter;
+    // Fastjet output
+    jetLoopBuffers fjBuffers;
+    std::vector<fastjet::PseudoJet>& sortedJets = fjBuffers.jets;
+    std::vector<fastjet::PseudoJet>& jetConstituents = fjBuffers.constituents;
+    // Fastjet input and output for the second constituent type
+    std::vector<fastjet::PseudoJet> fjParticlesMatch;
+    std::vector<fastjet::PseudoJet> sortedJetsMatch;
+    std::vector<int> matchIdx;
+    std::vector<float> matchDR;
+
+    // allocations in the jet loop, counted only if compiled with -DALLOCCOUNTER
+    // the allocations inside FastJet (clustering, WTA axis, soft drop, rho) are not counted
+    allocSection allocJetLoop;
+    unsigned long long nAllocLastEvent = 0;
+    unsigned long long nAllocTotal = 0;
 
     std::cout << "Clustering with " << fjJetDefn->description().c_str() << std::endl;
+    std::cout << "Clustering strategy : " << strategy.c_str() << std::endl;
+
+    // counter-based generators : the random numbers for a jet depend only on (seed, variant, entry, jet index)
+    // each smearing variant has its own stream, variant 0 has the same random numbers as a single variant run.
+    std::vector<counterRNG> rand1s;
+    std::vector<counterRNG> rand2s;
+    for (int iVar = 0; iVar < nVariants; ++iVar) {
+        rand1s.push_back(counterRNG(12345, iVar));
+        rand2s.push_back(counterRNG(6789, iVar));
+    }
+    // the clustering input is read from the columns of the event stores,
+    // the events are rebuilt only for the parton match and for the partons from hard scattering, which need the mothers
+    bool fillStoreEvents = useEventStore && (writePartonMatch > 0 || constituentType == CONSTITUENTS::kPartonHard
+                                                                  || matchConstituentType == CONSTITUENTS::kPartonHard);
+    eventStoreReader& storeEvtCluster = (usePartons) ? storeEvtParton : storeEvt;
 
-    TRandom3 rand1(12345);
-    TRandom3 rand2(6789);
     int eventsAnalyzed = 0;
-    int nEvents = treeEvt->GetEntries();
+    int nEvents = (useEventStore) ? storeEvt.getEntries() : treeEvt->GetEntries();
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
     for (int iEvent = 0; iEvent < nEvents; ++iEvent) {
 
         if (iEvent % 10000 == 0)  {
           std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
+          if (allocCounterEnabled()) {
+              std::cout << "allocations in the jet loop for the last event = " << nAllocLastEvent << std::endl;
+          }
         }
 
-        fjt.clearEvent();
-        treeEvt->GetEntry(iEvent);
-        treeEvtParton->GetEntry(iEvent);
+        if (doMatch) {
+            fjtMatch.clearEvent();
+        }
+        for (int iVar = 0; iVar < nVariants; ++iVar) {
+            fjts[iVar].clearEvent();
+            if (doMixEvt && !doOnlyMixEvt) {
+                fjtsMixSub[iVar].clearEvent();
+            }
+            if (subtractRho > 0) {
+                fjtsRhoSub[iVar].clearEvent();
+            }
+        }
+        if (fillStoreEvents) {
+            storeEvt.fillEvent(iEvent, *eventAll);
+            storeEvtParton.fillEvent(iEvent, *eventParton);
+        }
+        else if (!useEventStore) {
+            treeEvt->GetEntry(iEvent);
+            treeEvtParton->GetEntry(iEvent);
+        }
         if (doMixEvt) {
-            treeMixEvt->GetEntry(iEvent);
-            if (!doOnlyMixEvt) {
-                fjtMixSub.clearEvent();
+            if (useMixPool) {
+                mixEvt = &mixPool.getEvent(entryOffset + iEvent);
+            }
+            else {
+                treeMixEvt->GetEntry(iEvent);
+                mixEvtParticles.decode();
             }
         }
 
         eventsAnalyzed++;
 
+        allocJetLoop.start();
+
         // Reset Fastjet input
         fjParticles.resize(0);
 
-        int eventSize = event->size();
+        int eventSize = (useEventStore) ? (int)(storeEvtCluster.end(iEvent) - storeEvtCluster.begin(iEvent)) : event->size();
         if (doOnlyMixEvt) {
             eventSize = 0;
         }
 
-        for (int i = 0; i < eventSize; ++i) {
-
-            if (useFinalParticles) {
-
-                if (useFinalChParticles) {
-                    if (!((*event)[i].isFinal() && isCharged((*event)[i], pythia.particleData))) continue;
-                }
-                else {
-                    if (!(*event)[i].isFinal()) continue;
-                }
+        if (!doOnlyMixEvt) {
+            if (useEventStore && constituentType != CONSTITUENTS::kPartonHard) {
+                fillStoreParticles(fjParticles, storeEvtCluster, iEvent, constituentType, pythia.particleData);
             }
-            else if (constituentType == CONSTITUENTS::kPartonHard) {
-                int iOrig = (*event)[i].mother1();
-                if (!(isAncestor(eventAll, iOrig, 5) || isAncestor(eventAll, iOrig, 6))) continue;
+            else {
+                fillPythiaParticles(fjParticles, event, eventAll, constituentType, pythia.particleData);
             }
+        }
+
+        if (doMixEvt) {
+            // Store as input to Fastjet, only |eta| < 5
+            // particles from mixed event have index with value >= eventSize
+            fjConverter.fill(*mixEvt, fjParticles, (constituentType == CONSTITUENTS::kFinalCh_AND_MIX), eventSize);
+        }
+
+        // Run Fastjet algorithm
+        allocJetLoop.pause();
+        fastjet::ClusterSequence* clustSeq = 0;
+        if (subtractRho > 0) {
+            clustSeq = new fastjet::ClusterSequenceArea(fjParticles, fjJetDefnSelector.get(fjParticles.size()), areaDefn);
+        }
+        else {
+            clustSeq = new fastjet::ClusterSequence(fjParticles, fjJetDefnSelector.get(fjParticles.size()));
+        }
+        allocJetLoop.resume();
 
-            // No neutrinos
-            if (isNeutrino((*event)[i]))     continue;
+        // Extract inclusive jets sorted by pT (note the minimum pT)
+        fillSortedInclusiveJets(*clustSeq, minJetPt, sortedJets);
 
-            // Only |eta| < 5
-            if (std::fabs((*event)[i].eta()) > 5) continue;
+        int nSortedJets = sortedJets.size();
 
-            // Store as input to Fastjet
-            fastjet::PseudoJet fjParticle((*event)[i].px(),
-                                          (*event)[i].py(),
-                                          (*event)[i].pz(),
-                                          (*event)[i].e());
-            fjParticle.set_user_index(i);
+        int nSortedJetsMatch = 0;
+        if (doMatch) {
+            fjParticlesMatch.resize(0);
+            bool matchPartons = (matchConstituentType == CONSTITUENTS::kParton || matchConstituentType == CONSTITUENTS::kPartonHard);
+            if (useEventStore && matchConstituentType != CONSTITUENTS::kPartonHard) {
+                fillStoreParticles(fjParticlesMatch, (matchPartons) ? storeEvtParton : storeEvt, iEvent,
+                                   matchConstituentType, pythia.particleData);
+            }
+            else {
+                fillPythiaParticles(fjParticlesMatch, (matchPartons) ? eventParton : eventAll, eventAll,
+                                    matchConstituentType, pythia.particleData);
+            }
 
-            fjParticles.push_back(fjParticle);
+            allocJetLoop.pause();
+            fastjet::ClusterSequence clustSeqMatch(fjParticlesMatch, fjJetDefnMatchSelector.get(fjParticlesMatch.size()));
+            allocJetLoop.resume();
+            fillSortedInclusiveJets(clustSeqMatch, minJetPt, sortedJetsMatch);
+            nSortedJetsMatch = sortedJetsMatch.size();
+
+            // the match uses the jet axes before smearing
+            matchJets(sortedJets, sortedJetsMatch, matchMaxDR, matchIdx, matchDR, *fjtMatch.matchidx, *fjtMatch.matchdr, fjBuffers);
+
+            fjtMatch.reserve(nSortedJetsMatch);
+            for (int i = 0; i < nSortedJetsMatch; ++i) {
+                fjtMatch.rawpt->push_back(sortedJetsMatch[i].pt());
+                fjtMatch.jetpt->push_back(sortedJetsMatch[i].pt());
+                fjtMatch.jeteta->push_back(sortedJetsMatch[i].eta());
+                fjtMatch.rawphi->push_back(sortedJetsMatch[i].phi_std());
+                fjtMatch.jetphi->push_back(sortedJetsMatch[i].phi_std());
+                fjtMatch.nJet++;
+            }
         }
 
-        if (doMixEvt) {
-            for (int i = 0; i < mixEvtParticles.n; ++i) {
+        for (int iVar = 0; iVar < nVariants; ++iVar) {
+            fjts[iVar].reserve(nSortedJets);
+            if (doMixEvt && !doOnlyMixEvt) {
+                fjtsMixSub[iVar].reserve(nSortedJets);
+            }
+            if (subtractRho > 0) {
+                fjtsRhoSub[iVar].reserve(nSortedJets);
+            }
+        }
+        for (int i = 0; i < nSortedJets; ++i) {
 
-                if (constituentType == CONSTITUENTS::kFinalCh_AND_MIX) {
-                    if ((*mixEvtParticles.chg)[i] == 0) continue;
-                }
+            if (writeConstituents > 0 || writeSubstructure > 0) {
+                fillConstituents(sortedJets[i], jetConstituents);
+            }
 
-                // Only |eta| < 5
-                if (std::fabs((*mixEvtParticles.eta)[i]) > 5) continue;
+            fastjet::PseudoJet axisWTA;
+            if (writeWTAAxis > 0) {
+                allocJetLoop.pause();
+                axisWTA = getWTAAxis(sortedJets[i]);
+                allocJetLoop.resume();
+            }
 
-                TLorentzVector vec4;
-                vec4.SetPtEtaPhiM((*mixEvtParticles.pt)[i], (*mixEvtParticles.eta)[i], (*mixEvtParticles.phi)[i], 0);
+            for (int iVar = 0; iVar < nVariants; ++iVar) {
 
-                // Store as input to Fastjet
-                fastjet::PseudoJet fjParticle(vec4.Px(),
-                                              vec4.Py(),
-                                              vec4.Pz(),
-                                              vec4.E());
+                fastJetTree& fjt = fjts[iVar];
 
-                fjParticle.set_user_index(eventSize + i);
+                rand1s[iVar].setCounter(entryOffset + iEvent, i);
+                rand2s[iVar].setCounter(entryOffset + iEvent, i);
+                double sf = smearJetPts[iVar] ? getEnergySmearingFactor(rand1s[iVar], sortedJets[i].pt(),
+                                                                        csnPts[iVar][0], csnPts[iVar][1], csnPts[iVar][2]) : 1;
+                double sPhi = smearJetPhis[iVar] ? getAngleSmearing(rand2s[iVar], sortedJets[i].pt(),
+                                                                    csnPhis[iVar][0], csnPhis[iVar][1], csnPhis[iVar][2]) : 0;
 
-                fjParticles.push_back(fjParticle);
-            }
-        }
+                fjt.rawpt->push_back(sortedJets[i].pt());
+                fjt.jetpt->push_back(sf * sortedJets[i].pt());
+                fjt.jeteta->push_back(sortedJets[i].eta());
+                fjt.rawphi->push_back(sortedJets[i].phi_std());
+                fjt.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
+                fjt.nJet++;
 
-        // Run Fastjet algorithm
-        fastjet::ClusterSequence clustSeq(fjParticles, *fjJetDefn);
+                if (writePartonMatch > 0) {
+                    fillPartonMatch(fjt, eventAll, eventParton);
+                }
 
-        // Extract inclusive jets sorted by pT (note the minimum pT)
-        std::vector<fastjet::PseudoJet> inclusiveJets = clustSeq.inclusive_jets(minJetPt);
-        std::vector<fastjet::PseudoJet> sortedJets    = sorted_by_pt(inclusiveJets);
+                if (doMatch) {
+                    fjt.matchidx->push_back(matchIdx[i]);
+                    fjt.matchdr->push_back(matchDR[i]);
+                }
 
-        int nSortedJets = sortedJets.size();
-        for (int i = 0; i < nSortedJets; ++i) {
+                if (writeWTAAxis > 0) {
+                    fjt.wtaeta->push_back(axisWTA.eta());
+                    fjt.wtaphi->push_back(axisWTA.phi_std());
+                }
 
-            double sf = smearJetPt ? getEnergySmearingFactor(rand1, sortedJets[i].pt(), csnPt[0], csnPt[1], csnPt[2]) : 1;
-            double sPhi = smearJetPhi ? getAngleSmearing(rand2, sortedJets[i].pt(), csnPhi[0], csnPhi[1], csnPhi[2]) : 0;
+                if (writeSubstructure > 0) {
+                    // substructure does not depend on smearing, it is calculated once per jet
+                    if (iVar == 0) {
+                        allocJetLoop.pause();
+                        fillSubstructure(fjt, sortedJets[i], jetConstituents, jetRadius, sdZcut, sdBeta);
+                        allocJetLoop.resume();
+                    }
+                    else {
+                        copyLastSubstructure(fjt, fjts[0]);
+                    }
+                }
 
-            fjt.rawpt->push_back(sortedJets[i].pt());
-            fjt.jetpt->push_back(sf * sortedJets[i].pt());
-            fjt.jeteta->push_back(sortedJets[i].eta());
-            fjt.rawphi->push_back(sortedJets[i].phi_std());
-            fjt.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
-            fjt.nJet++;
+                if (writeConstituents > 0) {
+                    // index of a constituent is its index in the Pythia event
+                    // or (eventSize + its index in the mixed event) for a particle from mixed event
+                    fjt.constoffset->push_back(fjt.constidx->size());
+                    int nJetConstituents = jetConstituents.size();
+                    for (int j = 0; j < nJetConstituents; ++j) {
+                        fjt.constidx->push_back(jetConstituents[j].user_index());
+                    }
+                }
+            }
+        }
+        if (writeConstituents > 0) {
+            for (int iVar = 0; iVar < nVariants; ++iVar) {
+                fjts[iVar].constoffset->push_back(fjts[iVar].constidx->size());
+            }
         }
         if (doMixEvt && !doOnlyMixEvt) {
             for (int i = 0; i < nSortedJets; ++i) {
 
-                std::vector<fastjet::PseudoJet> jetConstituents = sortedJets[i].constituents();
-                TLorentzVector vec4MixTot;
-                vec4MixTot.SetPtEtaPhiM(0,0,0,0);
+                fillConstituents(sortedJets[i], jetConstituents);
+                // particles from mixed event are massless
+                double eMixTot = 0;
 
                 int nJetConstituents = jetConstituents.size();
                 for (int j = 0; j < nJetConstituents; ++j) {
@@ -335,78 +866,399 @@ void pythiaClusterJets(std::string inputFileName, std::string outputFileName, in
                     // particles from Pythia event have index with value < eventSize
                     if (jetConstituents[j].user_index() < eventSize)  continue;
 
-                    TLorentzVector vec4;
-                    vec4.SetPtEtaPhiM(jetConstituents[j].pt(), jetConstituents[j].eta(), jetConstituents[j].phi_std(), 0);
-                    vec4MixTot += vec4;
+                    eMixTot += jetConstituents[j].E();
                 }
 
-                double eMixSub = sortedJets[i].E() - vec4MixTot.E();
+                double eMixSub = sortedJets[i].E() - eMixTot;
                 if (eMixSub < 0) eMixSub = 0;
                 double ptMixSub = eMixSub / std::cosh(sortedJets[i].eta());
 
-                double sf = smearJetPt ? getEnergySmearingFactor(rand1, ptMixSub, csnPt[0], csnPt[1], csnPt[2]) : 1;
-                double sPhi = smearJetPhi ? getAngleSmearing(rand2, ptMixSub, csnPhi[0], csnPhi[1], csnPhi[2]) : 0;
+                for (int iVar = 0; iVar < nVariants; ++iVar) {
+
+                    fastJetTree& fjtMixSub = fjtsMixSub[iVar];
+
+                    // same random numbers as the corresponding jet in jetTree
+                    rand1s[iVar].setCounter(entryOffset + iEvent, i);
+                    rand2s[iVar].setCounter(entryOffset + iEvent, i);
+                    double sf = smearJetPts[iVar] ? getEnergySmearingFactor(rand1s[iVar], ptMixSub,
+                                                                            csnPts[iVar][0], csnPts[iVar][1], csnPts[iVar][2]) : 1;
+                    double sPhi = smearJetPhis[iVar] ? getAngleSmearing(rand2s[iVar], ptMixSub,
+                                                                        csnPhis[iVar][0], csnPhis[iVar][1], csnPhis[iVar][2]) : 0;
+
+                    fjtMixSub.rawpt->push_back(ptMixSub);
+                    fjtMixSub.jetpt->push_back(sf * ptMixSub);
+                    fjtMixSub.jeteta->push_back(sortedJets[i].eta());
+                    fjtMixSub.rawphi->push_back(sortedJets[i].phi_std());
+                    fjtMixSub.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
+                    fjtMixSub.nJet++;
+
+                    if (writePartonMatch > 0) {
+                        fillPartonMatch(fjtMixSub, eventAll, eventParton);
+                    }
+
+                    if (writeConstituents > 0) {
+                        fjtMixSub.constoffset->push_back(fjtMixSub.constidx->size());
+                        for (int j = 0; j < nJetConstituents; ++j) {
+                            fjtMixSub.constidx->push_back(jetConstituents[j].user_index());
+                        }
+                    }
+                }
+            }
+            if (writeConstituents > 0) {
+                for (int iVar = 0; iVar < nVariants; ++iVar) {
+                    fjtsMixSub[iVar].constoffset->push_back(fjtsMixSub[iVar].constidx->size());
+                }
+            }
+        }
+
+        if (subtractRho > 0) {
+            allocJetLoop.pause();
+            bkgEstimator.set_particles(fjParticles);
+            double rho = bkgEstimator.rho();
+            allocJetLoop.resume();
+            for (int iVar = 0; iVar < nVariants; ++iVar) {
+                fjtsRhoSub[iVar].rho = rho;
+            }
+
+            for (int i = 0; i < nSortedJets; ++i) {
+
+                double jetArea = sortedJets[i].area();
+                double ptRhoSub = sortedJets[i].pt() - rho * jetArea;
+                if (ptRhoSub < 0) ptRhoSub = 0;
+
+                if (writeConstituents > 0) {
+                    fillConstituents(sortedJets[i], jetConstituents);
+                }
 
-                fjtMixSub.rawpt->push_back(ptMixSub);
-                fjtMixSub.jetpt->push_back(sf * ptMixSub);
-                fjtMixSub.jeteta->push_back(sortedJets[i].eta());
-                fjtMixSub.rawphi->push_back(sortedJets[i].phi_std());
-                fjtMixSub.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
-                fjtMixSub.nJet++;
+                for (int iVar = 0; iVar < nVariants; ++iVar) {
+
+                    fastJetTree& fjtRhoSub = fjtsRhoSub[iVar];
+
+                    // same random numbers as the corresponding jet in jetTree
+                    rand1s[iVar].setCounter(entryOffset + iEvent, i);
+                    rand2s[iVar].setCounter(entryOffset + iEvent, i);
+                    double sf = smearJetPts[iVar] ? getEnergySmearingFactor(rand1s[iVar], ptRhoSub,
+                                                                            csnPts[iVar][0], csnPts[iVar][1], csnPts[iVar][2]) : 1;
+                    double sPhi = smearJetPhis[iVar] ? getAngleSmearing(rand2s[iVar], ptRhoSub,
+                                                                        csnPhis[iVar][0], csnPhis[iVar][1], csnPhis[iVar][2]) : 0;
+
+                    fjtRhoSub.rawpt->push_back(ptRhoSub);
+                    fjtRhoSub.jetpt->push_back(sf * ptRhoSub);
+                    fjtRhoSub.jeteta->push_back(sortedJets[i].eta());
+                    fjtRhoSub.rawphi->push_back(sortedJets[i].phi_std());
+                    fjtRhoSub.jetphi->push_back(correctPhiRange(sortedJets[i].phi_std() + sPhi));
+                    fjtRhoSub.jetarea->push_back(jetArea);
+                    fjtRhoSub.nJet++;
+
+                    if (writePartonMatch > 0) {
+                        fillPartonMatch(fjtRhoSub, eventAll, eventParton);
+                    }
+
+                    if (writeConstituents > 0) {
+                        fjtRhoSub.constoffset->push_back(fjtRhoSub.constidx->size());
+                        int nJetConstituents = jetConstituents.size();
+                        for (int j = 0; j < nJetConstituents; ++j) {
+                            fjtRhoSub.constidx->push_back(jetConstituents[j].user_index());
+                        }
+                    }
+                }
+            }
+            if (writeConstituents > 0) {
+                for (int iVar = 0; iVar < nVariants; ++iVar) {
+                    fjtsRhoSub[iVar].constoffset->push_back(fjtsRhoSub[iVar].constidx->size());
+                }
             }
         }
 
-        jetTree->Fill();
-        if (doMixEvt && !doOnlyMixEvt) {
-            jetMixSubTree->Fill();
+        allocJetLoop.pause();
+        delete clustSeq;
+        allocJetLoop.resume();
+
+        nAllocLastEvent = allocJetLoop.count();
+        nAllocTotal += nAllocLastEvent;
+
+        if (doMatch) {
+            fjtMatch.encode();
+            jetMatchTree->fill();
+        }
+        for (int iVar = 0; iVar < nVariants; ++iVar) {
+            fjts[iVar].encode();
+            jetTrees[iVar]->fill();
+            if (doMixEvt && !doOnlyMixEvt) {
+                fjtsMixSub[iVar].encode();
+                jetMixSubTrees[iVar]->fill();
+            }
+            if (subtractRho > 0) {
+                fjtsRhoSub[iVar].encode();
+                jetRhoSubTrees[iVar]->fill();
+            }
         }
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
-    std::cout<<"Closing the input file"<<std::endl;
-    inputFile->Close();
-
+    if (allocCounterEnabled() && eventsAnalyzed > 0) {
+        std::cout << "allocations in the jet loop per event = " << (double)nAllocTotal / eventsAnalyzed << std::endl;
+    }
+    readSetup.printStats();
+    std::cout<<"Closing the input files"<<std::endl;
+    delete treeEvt;
+    delete treeEvtParton;
+    delete treeMixEvt;
+
+    // RNTuples are written at close
+    delete jetMatchTree;
+    for (int iVar = 0; iVar < nVariants; ++iVar) {
+        delete jetTrees[iVar];
+        delete jetMixSubTrees[iVar];
+        delete jetRhoSubTrees[iVar];
+    }
     outputFile->Write("", TObject::kOverwrite);
+    if (partialOutput == 0) {
+        writeCacheKey(outputFile, cacheKeyName, cacheKey);
+    }
     std::cout<<"Closing the output file"<<std::endl;
     outputFile->Close();
 
     std::cout << "running pythiaClusterJets() - END" << std::endl;
 }
 
+/*
+ * match the last jet in "fjt" to the closest particle from hard scattering.
+ * The jet axis as written to the tree (after smearing) is used, as done in the analysis code.
+ */
+void fillPartonMatch(fastJetTree& fjt, Pythia8::Event* eventAll, Pythia8::Event* eventParton)
+{
+    int iJet = fjt.nJet - 1;
+    double jeteta = (*fjt.jeteta)[iJet];
+    double jetphi = (*fjt.jetphi)[iJet];
+
+    int iParton = getIndexClosestHardParton(eventAll, jeteta, jetphi);
+
+    fjt.partonidx->push_back(iParton);
+    fjt.partonid->push_back((*eventAll)[iParton].id());
+    fjt.partonoutidx->push_back(getIndexLeadingOutDaughter(eventAll, eventParton, iParton));
+    fjt.partondr->push_back(getDR(jeteta, jetphi, (*eventAll)[iParton].eta(), (*eventAll)[iParton].phi()));
+}
+
+/*
+ * appends the particles of "event" which are used as jet constituents for "constituentType" to "fjParticles"
+ * user_index of a PseudoJet is the index of the particle in "event"
+ */
+void fillPythiaParticles(std::vector<fastjet::PseudoJet>& fjParticles, Pythia8::Event* event, Pythia8::Event* eventAll,
+                         int constituentType, Pythia8::ParticleData& particleData)
+{
+    bool useFinalParticles = (constituentType == CONSTITUENTS::kFinal
+            || constituentType == CONSTITUENTS::kFinalCh
+            || constituentType == CONSTITUENTS::kFinal_AND_MIX
+            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX
+            || constituentType == CONSTITUENTS::kFinal_WTA
+            || constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA);
+    bool useFinalChParticles = useFinalParticles && (constituentType == CONSTITUENTS::kFinalCh
+            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX);
+
+    int eventSize = event->size();
+    for (int i = 0; i < eventSize; ++i) {
+
+        if (useFinalParticles) {
+
+            if (useFinalChParticles) {
+                if (!((*event)[i].isFinal() && isCharged((*event)[i], particleData))) continue;
+            }
+            else {
+                if (!(*event)[i].isFinal()) continue;
+            }
+        }
+        else if (constituentType == CONSTITUENTS::kPartonHard) {
+            int iOrig = (*event)[i].mother1();
+            if (!(isAncestor(eventAll, iOrig, 5) || isAncestor(eventAll, iOrig, 6))) continue;
+        }
+
+        // No neutrinos
+        if (isNeutrino((*event)[i]))     continue;
+
+        // Only |eta| < 5
+        if (std::fabs((*event)[i].eta()) > 5) continue;
+
+        // Store as input to Fastjet
+        fastjet::PseudoJet fjParticle((*event)[i].px(),
+                                      (*event)[i].py(),
+                                      (*event)[i].pz(),
+                                      (*event)[i].e());
+        fjParticle.set_user_index(i);
+
+        fjParticles.push_back(fjParticle);
+    }
+}
+
+/*
+ * same as fillPythiaParticles(), but reads event "iEvent" directly from the columns of an event store.
+ * Not for kPartonHard, which needs the mothers of the particles from the Pythia8::Event of all particles.
+ */
+void fillStoreParticles(std::vector<fastjet::PseudoJet>& fjParticles, const eventStoreReader& store, long long iEvent,
+                        int constituentType, Pythia8::ParticleData& particleData)
+{
+    bool useFinalParticles = (constituentType == CONSTITUENTS::kFinal
+            || constituentType == CONSTITUENTS::kFinalCh
+            || constituentType == CONSTITUENTS::kFinal_AND_MIX
+            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX
+            || constituentType == CONSTITUENTS::kFinal_WTA
+            || constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA);
+    bool useFinalChParticles = useFinalParticles && (constituentType == CONSTITUENTS::kFinalCh
+            || constituentType == CONSTITUENTS::kFinalCh_AND_MIX);
+
+    const double* px = store.column(EVENTSTORE::kPx);
+    const double* py = store.column(EVENTSTORE::kPy);
+    const double* pz = store.column(EVENTSTORE::kPz);
+    const double* e = store.column(EVENTSTORE::kE);
+    const int* id = store.columnInt(EVENTSTORE::kId);
+    const int* status = store.columnInt(EVENTSTORE::kStatus);
+
+    uint64_t iBegin = store.begin(iEvent);
+    uint64_t iEnd = store.end(iEvent);
+    for (uint64_t i = iBegin; i < iEnd; ++i) {
+
+        // Particle::isFinal()
+        if (useFinalParticles && status[i] <= 0) continue;
+        if (useFinalChParticles && particleData.charge(id[i]) == 0) continue;
+
+        // No neutrinos
+        int idAbs = std::abs(id[i]);
+        if (idAbs == 12 || idAbs == 14 || idAbs == 16) continue;
+
+        // Only |eta| < 5, |eta| is calculated as in Particle::eta()
+        double pT = std::sqrt(px[i]*px[i] + py[i]*py[i]);
+        double pAbs = std::sqrt(px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i]);
+        double etaAbs = std::log((pAbs + std::fabs(pz[i])) / std::max(1e-20, pT));
+        if (etaAbs > 5) continue;
+
+        // Store as input to Fastjet
+        fastjet::PseudoJet fjParticle(px[i], py[i], pz[i], e[i]);
+        fjParticle.set_user_index(i - iBegin);
+
+        fjParticles.push_back(fjParticle);
+    }
+}
+
+/*
+ * name and title of the jet tree for "constituentType"
+ */
+void setJetTreeNameTitle(std::string& jetTreeName, std::string& jetTreeTitle, int dR, int constituentType)
+{
+    double jetRadius = (double)dR / 10;
+
+    jetTreeName = Form("ak%djets", dR);
+    jetTreeTitle = Form("jets with R = %.1f", jetRadius);
+    if (constituentType == CONSTITUENTS::kFinalCh) {
+        jetTreeName = Form("ak%djetsCh", dR);
+        jetTreeTitle = Form("charged particle jets with R = %.1f", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kParton) {
+        jetTreeName = Form("ak%djetsParton", dR);
+        jetTreeTitle = Form("partonic jets with R = %.1f", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kPartonHard) {
+        jetTreeName = Form("ak%djetsPartonHard", dR);
+        jetTreeTitle = Form("partonic jets from hard scattering with R = %.1f", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kFinal_AND_MIX) {
+        jetTreeName = Form("ak%djetsMixed", dR);
+        jetTreeTitle = Form("jets with R = %.1f from Pythia+MIX event", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kFinalCh_AND_MIX) {
+        jetTreeName = Form("ak%djetsChMixed", dR);
+        jetTreeTitle = Form("charged particle jets with R = %.1f from Pythia+MIX event", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kFinal_WTA) {
+        jetTreeName = Form("ak%djetsWTA", dR);
+        jetTreeTitle = Form("jets with R = %.1f, WTA", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kFinal_AND_MIX_WTA) {
+        jetTreeName = Form("ak%djetsWTAMixed", dR);
+        jetTreeTitle = Form("jets with R = %.1f, WTA, from Pythia+MIX event", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kMIX) {
+        jetTreeName = Form("ak%djetsOnlyMixed", dR);
+        jetTreeTitle = Form("jets with R = %.1f from MIX event", jetRadius);
+    }
+    else if (constituentType == CONSTITUENTS::kMIX_WTA) {
+        jetTreeName = Form("ak%djetsWTAOnlyMixed", dR);
+        jetTreeTitle = Form("jets with R = %.1f, WTA, from MIX event", jetRadius);
+    }
+}
+
 int main(int argc, char* argv[]) {
 
-    if (argc == 8) {
-        pythiaClusterJets(argv[1], argv[2], std::atoi(argv[3]), std::atoi(argv[4]), std::atoi(argv[5]), argv[6], argv[7]);
+    std::vector<std::string> argStr = ArgumentParser::ParseParameters(argc, argv);
+    int nArgStr = argStr.size();
+
+    argOptions = ArgumentParser::ParseOptions(argc, argv);
+
+    if (nArgStr == 8) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2), std::atoi(argStr.at(3).c_str()), std::atoi(argStr.at(4).c_str()),
+                          std::atoi(argStr.at(5).c_str()), argStr.at(6), argStr.at(7));
         return 0;
     }
-    else if (argc == 7) {
-        pythiaClusterJets(argv[1], argv[2], std::atoi(argv[3]), std::atoi(argv[4]), std::atoi(argv[5]), argv[6]);
+    else if (nArgStr == 7) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2), std::atoi(argStr.at(3).c_str()), std::atoi(argStr.at(4).c_str()),
+                          std::atoi(argStr.at(5).c_str()), argStr.at(6));
         return 0;
     }
-    else if (argc == 6) {
-        pythiaClusterJets(argv[1], argv[2], std::atoi(argv[3]), std::atoi(argv[4]), std::atoi(argv[5]));
+    else if (nArgStr == 6) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2), std::atoi(argStr.at(3).c_str()), std::atoi(argStr.at(4).c_str()),
+                          std::atoi(argStr.at(5).c_str()));
         return 0;
     }
-    else if (argc == 5) {
-        pythiaClusterJets(argv[1], argv[2], std::atoi(argv[3]), std::atoi(argv[4]));
+    else if (nArgStr == 5) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2), std::atoi(argStr.at(3).c_str()), std::atoi(argStr.at(4).c_str()));
         return 0;
     }
-    else if (argc == 4) {
-        pythiaClusterJets(argv[1], argv[2], std::atoi(argv[3]));
+    else if (nArgStr == 4) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2), std::atoi(argStr.at(3).c_str()));
         return 0;
     }
-    else if (argc == 3) {
-        pythiaClusterJets(argv[1], argv[2]);
+    else if (nArgStr == 3) {
+        pythiaClusterJets(argStr.at(1), argStr.at(2));
         return 0;
     }
-    else if (argc == 2) {
-        pythiaClusterJets(argv[1]);
+    else if (nArgStr == 2) {
+        pythiaClusterJets(argStr.at(1));
         return 0;
     }
     else {
         std::cout << "Usage : \n" <<
                 "./pythiaClusterJets.exe <inputFileName> <outputFileName> <jetRadius> <minJetPt> <constituentType> <jetptCSN> <jetphiCSN>"
                 << std::endl;
+        std::cout << "jetptCSN and jetphiCSN can be semicolon separated lists of C,S,N sets, one smeared tree is written per set" << std::endl;
+        std::cout << "at most one of the sets can be without smearing" << std::endl;
+        std::cout << "inputFileName can be a comma separated list, a wildcard or a .list/.txt file with one file per line" << std::endl;
+        std::cout << "Options are" << std::endl;
+        std::cout << "writeConstituents=<write the indices of jet constituents if > 0>" << std::endl;
+        std::cout << "writePartonMatch=<write the matched hard scattering parton for each jet if > 0>" << std::endl;
+        std::cout << "subtractRho=<write a tree with rho*A subtracted jets if > 0, rho is from grid median>" << std::endl;
+        std::cout << "rhoGridSpacing=<size of the eta-phi tiles used for rho>" << std::endl;
+        std::cout << "rhoMaxRap=<maximum |rapidity| of the tiles used for rho>" << std::endl;
+        std::cout << "writeWTAAxis=<write also the WTA axis of E-scheme jets if > 0>" << std::endl;
+        std::cout << "writeSubstructure=<write nConst, pTD, angularities and soft drop zg, Rg of jets if > 0>" << std::endl;
+        std::cout << "sdZcut=<zcut of soft drop>" << std::endl;
+        std::cout << "sdBeta=<beta of soft drop>" << std::endl;
+        std::cout << "mixPoolFile=<file with a particleTree, MIX events are picked from a pool of its events>" << std::endl;
+        std::cout << "mixPoolTree=<path of the particleTree in mixPoolFile>" << std::endl;
+        std::cout << "mixPoolThermalMult=<minMultCh,maxMultCh : MIX events are picked from a pool of thermal events>" << std::endl;
+        std::cout << "mixPoolThermalMeanPt=<mean pt of thermal events>" << std::endl;
+        std::cout << "mixPoolThermalMaxEta=<maximum |eta| of thermal events>" << std::endl;
+        std::cout << "mixPoolSize=<number of events in the MIX pool>" << std::endl;
+        std::cout << "mixPoolSeed=<seed for generating and picking the MIX events>" << std::endl;
+        std::cout << "mixPoolRotatePhi=<rotate the picked MIX event by a random angle in phi if > 0>" << std::endl;
+        std::cout << "matchConstituentType=<cluster also this constituent type and match its jets to the jets of constituentType>" << std::endl;
+        std::cout << "matchMaxDR=<maximum dR for matched jets, default is the jet radius>" << std::endl;
+        std::cout << "noCache=<cluster even if the output has the jet trees from a job with the same inputs if > 0>" << std::endl;
+        std::cout << "storage=<backend of the jet outputs : TTree or RNTuple>" << std::endl;
+        std::cout << "eventStore=<directory of the event stores written by convertEventStore>" << std::endl;
+        std::cout << "flatLayout=<write the jet trees with C arrays, ex. jetpt[nJet]/F, with this initial capacity if > 0>" << std::endl;
+        std::cout << "reducedPrecision=<write the jet kinematics with truncated mantissas if > 0>" << std::endl;
+        std::cout << "strategy=<clustering strategy : best, N2Plain, N2Tiled, NlnN or auto>" << std::endl;
+        std::cout << "nParallel=<number of input files processed concurrently, the jet trees are merged at the end>" << std::endl;
+        treeReadSetup().printUsage();
         return 1;
     }
 }
@@ -8,10 +8,9 @@
 #include "TTree.h"
 #include "TFile.h"
 
-#include "dictionary/dict4Root.h"
-#include "dictionary/dict4RootDct.cc"
 // dictionary is needed to avoid the following error :
 // Error in <TTree::Branch>: The pointer specified for event is not of a class known to ROOT
+// the dictionary is built as dictionary/libdict4Root.so and linked by the Makefile
 #include "utils/pythiaUtil.h"
 #include "../utilities/systemUtil.h"
 
@@ -108,7 +107,7 @@ void pythiaGenerateAndWrite(std::string cardFileName, std::string outFileName, s
         // Generate events. Quit if many failures.
         if (!pythia.next()) {
             if (++iAbort < nAbort) continue;
-            cout << " Event generation aborted prematurely, owing to error!\n";
+            std::cout << " Event generation aborted prematurely, owing to error!\n";
             break;
         }
         eventsGenerated++;
@@ -0,0 +1,40 @@
+#!/bin/bash
+
+## compares the read throughput of TTree and RNTuple for the jet outputs of the QCD and photon samples
+runCmd=""
+if [ ! -z ${MYRUN} ]; then
+  runCmd=${MYRUN}
+fi
+
+progPath="./benchmarkReadStorage.exe"
+
+inputFiles=(
+"./out/jets/qcd/pythiaClusterJets_hardQCD.root"
+"./out/jets/qcd/pythiaClusterJets_hardQCD.root"
+"./out/jets/photon/pythiaClusterJets_promptPhoton.root"
+"./out/jets/photon/pythiaClusterJets_promptPhoton.root"
+);
+
+treePaths=(
+"ak3jets"
+"ak4jets"
+"ak3jets"
+"ak4jets"
+);
+
+nRepeat=3
+
+arrayIndices=${!inputFiles[*]}
+for i1 in $arrayIndices
+do
+    inputFile=${inputFiles[i1]}
+    treePath=${treePaths[i1]}
+
+    tmpFile="${inputFile/.root/_${treePath}_benchmarkReadStorage.root}"
+    outputFileLOG="${tmpFile/.root/.log}"
+
+    $runCmd $progPath $inputFile $treePath $tmpFile --nRepeat=${nRepeat} &> $outputFileLOG &
+    echo "$runCmd $progPath $inputFile $treePath $tmpFile --nRepeat=${nRepeat} &> $outputFileLOG &"
+    wait
+    rm -f $tmpFile
+done
@@ -0,0 +1,261 @@
+/*
+ * memory-mapped store of Pythia8::Event records.
+ * A store is a directory with one uncompressed binary file per column, the files are arrays in native byte order :
+ *  - offsets.bin : uint64, nEvents+1 entries, the particles of event i are the entries [offsets[i], offsets[i+1]) of the particle columns
+ *  - evtScale.bin, evtScaleSecond.bin : double, one entry per event, Event::scale() and Event::scaleSecond()
+ *  - one file per particle column : px, py, pz, e, m, scale, pol (double), id, status, mother1, mother2, daughter1, daughter2, col, acol (int)
+ * The reader maps the files, the columns are read directly from the mapped pages without decompression or streaming.
+ * The production vertex and the lifetime of the particles are not stored.
+ */
+
+#ifndef EVENTSTORE_H_
+#define EVENTSTORE_H_
+
+#include "Pythia8/Event.h"
+
+#include "../../utilities/mappedFile.h"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+
+namespace EVENTSTORE {
+
+enum DCOLUMNS {
+    kPx,
+    kPy,
+    kPz,
+    kE,
+    kM,
+    kScale,
+    kPol,
+    kN_DCOLUMNS
+};
+
+const std::string DCOLUMNNAMES[kN_DCOLUMNS] = {"px", "py", "pz", "e", "m", "scale", "pol"};
+
+enum ICOLUMNS {
+    kId,
+    kStatus,
+    kMother1,
+    kMother2,
+    kDaughter1,
+    kDaughter2,
+    kCol,
+    kAcol,
+    kN_ICOLUMNS
+};
+
+const std::string ICOLUMNNAMES[kN_ICOLUMNS] = {"id", "status", "mother1", "mother2", "daughter1", "daughter2", "col", "acol"};
+
+};
+
+/*
+ * appends events to a store, close() must be called after the last event
+ */
+class eventStoreWriter {
+public :
+    eventStoreWriter();
+    ~eventStoreWriter() { close(); };
+
+    bool open(std::string dirPath);
+    void write(Pythia8::Event& event);
+    void close();
+
+    uint64_t nEvents;
+    uint64_t nParticles;
+
+private :
+    eventStoreWriter(const eventStoreWriter&);
+    eventStoreWriter& operator=(const eventStoreWriter&);
+
+    FILE* fileOffsets;
+    FILE* fileEvtScale;
+    FILE* fileEvtScaleSecond;
+    FILE* filesD[EVENTSTORE::kN_DCOLUMNS];
+    FILE* filesI[EVENTSTORE::kN_ICOLUMNS];
+};
+
+/*
+ * reads a store, the columns point to the mapped files
+ */
+class eventStoreReader {
+public :
+    eventStoreReader() : nEvents(0), nParticles(0), offsets(0), evtScale(0), evtScaleSecond(0) {};
+    ~eventStoreReader(){};
+
+    bool open(std::string dirPath);
+    long long getEntries() const { return nEvents; };
+    // particles of event "iEvent" are the entries [begin(iEvent), end(iEvent)) of the columns
+    uint64_t begin(long long iEvent) const { return offsets[iEvent]; };
+    uint64_t end(long long iEvent) const { return offsets[iEvent+1]; };
+    const double* column(int iColumn) const { return columnsD[iColumn]; };
+    const int* columnInt(int iColumn) const { return columnsI[iColumn]; };
+    void fillEvent(long long iEvent, Pythia8::Event& event) const;
+
+private :
+    uint64_t nEvents;
+    uint64_t nParticles;
+
+    mappedFile fileOffsets;
+    mappedFile fileEvtScale;
+    mappedFile fileEvtScaleSecond;
+    mappedFile filesD[EVENTSTORE::kN_DCOLUMNS];
+    mappedFile filesI[EVENTSTORE::kN_ICOLUMNS];
+
+    const uint64_t* offsets;
+    const double* evtScale;
+    const double* evtScaleSecond;
+    const double* columnsD[EVENTSTORE::kN_DCOLUMNS];
+    const int* columnsI[EVENTSTORE::kN_ICOLUMNS];
+};
+
+eventStoreWriter::eventStoreWriter()
+{
+    nEvents = 0;
+    nParticles = 0;
+    fileOffsets = 0;
+    fileEvtScale = 0;
+    fileEvtScaleSecond = 0;
+    for (int i = 0; i < EVENTSTORE::kN_DCOLUMNS; ++i) {
+        filesD[i] = 0;
+    }
+    for (int i = 0; i < EVENTSTORE::kN_ICOLUMNS; ++i) {
+        filesI[i] = 0;
+    }
+}
+
+/*
+ * creates the directory "dirPath" if needed, existing column files are overwritten.
+ * returns false if any of the files cannot be opened.
+ */
+bool eventStoreWriter::open(std::string dirPath)
+{
+    close();
+    mkdir(dirPath.c_str(), 0755);
+
+    fileOffsets = fopen((dirPath + "/offsets.bin").c_str(), "wb");
+    fileEvtScale = fopen((dirPath + "/evtScale.bin").c_str(), "wb");
+    fileEvtScaleSecond = fopen((dirPath + "/evtScaleSecond.bin").c_str(), "wb");
+    bool res = (fileOffsets != 0 && fileEvtScale != 0 && fileEvtScaleSecond != 0);
+    for (int i = 0; i < EVENTSTORE::kN_DCOLUMNS; ++i) {
+        filesD[i] = fopen((dirPath + "/" + EVENTSTORE::DCOLUMNNAMES[i] + ".bin").c_str(), "wb");
+        res = res && (filesD[i] != 0);
+    }
+    for (int i = 0; i < EVENTSTORE::kN_ICOLUMNS; ++i) {
+        filesI[i] = fopen((dirPath + "/" + EVENTSTORE::ICOLUMNNAMES[i] + ".bin").c_str(), "wb");
+        res = res && (filesI[i] != 0);
+    }
+    if (!res) {
+        close();
+        return false;
+    }
+
+    nEvents = 0;
+    nParticles = 0;
+    fwrite(&nParticles, sizeof(uint64_t), 1, fileOffsets);
+    return true;
+}
+
+void eventStoreWriter::write(Pythia8::Event& event)
+{
+    int eventSize = event.size();
+    for (int i = 0; i < eventSize; ++i) {
+        const Pythia8::Particle& part = event[i];
+
+        double valuesD[EVENTSTORE::kN_DCOLUMNS] = {part.px(), part.py(), part.pz(), part.e(), part.m(), part.scale(), part.pol()};
+        int valuesI[EVENTSTORE::kN_ICOLUMNS] = {part.id(), part.status(), part.mother1(), part.mother2(),
+                                                part.daughter1(), part.daughter2(), part.col(), part.acol()};
+        for (int j = 0; j < EVENTSTORE::kN_DCOLUMNS; ++j) {
+            fwrite(&valuesD[j], sizeof(double), 1, filesD[j]);
+        }
+        for (int j = 0; j < EVENTSTORE::kN_ICOLUMNS; ++j) {
+            fwrite(&valuesI[j], sizeof(int), 1, filesI[j]);
+        }
+    }
+
+    double scale = event.scale();
+    double scaleSecond = event.scaleSecond();
+    fwrite(&scale, sizeof(double), 1, fileEvtScale);
+    fwrite(&scaleSecond, sizeof(double), 1, fileEvtScaleSecond);
+
+    nParticles += eventSize;
+    nEvents++;
+    fwrite(&nParticles, sizeof(uint64_t), 1, fileOffsets);
+}
+
+void eventStoreWriter::close()
+{
+    if (fileOffsets != 0) fclose(fileOffsets);
+    if (fileEvtScale != 0) fclose(fileEvtScale);
+    if (fileEvtScaleSecond != 0) fclose(fileEvtScaleSecond);
+    fileOffsets = 0;
+    fileEvtScale = 0;
+    fileEvtScaleSecond = 0;
+    for (int i = 0; i < EVENTSTORE::kN_DCOLUMNS; ++i) {
+        if (filesD[i] != 0) fclose(filesD[i]);
+        filesD[i] = 0;
+    }
+    for (int i = 0; i < EVENTSTORE::kN_ICOLUMNS; ++i) {
+        if (filesI[i] != 0) fclose(filesI[i]);
+        filesI[i] = 0;
+    }
+}
+
+/*
+ * maps the files of the store in "dirPath", returns false if a file is missing or the sizes are not consistent
+ */
+bool eventStoreReader::open(std::string dirPath)
+{
+    if (!fileOffsets.open(dirPath + "/offsets.bin")) return false;
+    if (fileOffsets.size() < sizeof(uint64_t)) return false;
+
+    offsets = (const uint64_t*)fileOffsets.data();
+    nEvents = fileOffsets.size() / sizeof(uint64_t) - 1;
+    nParticles = offsets[nEvents];
+
+    if (!fileEvtScale.open(dirPath + "/evtScale.bin")) return false;
+    if (!fileEvtScaleSecond.open(dirPath + "/evtScaleSecond.bin")) return false;
+    if (fileEvtScale.size() != nEvents * sizeof(double)) return false;
+    if (fileEvtScaleSecond.size() != nEvents * sizeof(double)) return false;
+    evtScale = (const double*)fileEvtScale.data();
+    evtScaleSecond = (const double*)fileEvtScaleSecond.data();
+
+    for (int i = 0; i < EVENTSTORE::kN_DCOLUMNS; ++i) {
+        if (!filesD[i].open(dirPath + "/" + EVENTSTORE::DCOLUMNNAMES[i] + ".bin")) return false;
+        if (filesD[i].size() != nParticles * sizeof(double)) return false;
+        columnsD[i] = (const double*)filesD[i].data();
+    }
+    for (int i = 0; i < EVENTSTORE::kN_ICOLUMNS; ++i) {
+        if (!filesI[i].open(dirPath + "/" + EVENTSTORE::ICOLUMNNAMES[i] + ".bin")) return false;
+        if (filesI[i].size() != nParticles * sizeof(int)) return false;
+        columnsI[i] = (const int*)filesI[i].data();
+    }
+
+    return true;
+}
+
+/*
+ * rebuilds event "iEvent" in "event" for the code which uses the Pythia8::Event interface.
+ * "event" must have been initialized with Pythia8::Event::init(), append() uses its particle data.
+ */
+void eventStoreReader::fillEvent(long long iEvent, Pythia8::Event& event) const
+{
+    event.clear();
+    for (uint64_t i = begin(iEvent); i < end(iEvent); ++i) {
+        event.append(Pythia8::Particle(columnsI[EVENTSTORE::kId][i], columnsI[EVENTSTORE::kStatus][i],
+                                       columnsI[EVENTSTORE::kMother1][i], columnsI[EVENTSTORE::kMother2][i],
+                                       columnsI[EVENTSTORE::kDaughter1][i], columnsI[EVENTSTORE::kDaughter2][i],
+                                       columnsI[EVENTSTORE::kCol][i], columnsI[EVENTSTORE::kAcol][i],
+                                       columnsD[EVENTSTORE::kPx][i], columnsD[EVENTSTORE::kPy][i],
+                                       columnsD[EVENTSTORE::kPz][i], columnsD[EVENTSTORE::kE][i],
+                                       columnsD[EVENTSTORE::kM][i], columnsD[EVENTSTORE::kScale][i],
+                                       columnsD[EVENTSTORE::kPol][i]));
+    }
+    event.scale(evtScale[iEvent]);
+    event.scaleSecond(evtScaleSecond[iEvent]);
+}
+
+#endif /* EVENTSTORE_H_ */
@@ -261,6 +261,7 @@ bool isCharged(Pythia8::Particle particle, Pythia8::ParticleData& particleData);
 bool hasDaughter(Pythia8::Particle particle);
 bool isAncestor(Pythia8::Event* evtPtr, int iParticle, int iAncestor);
 int getIndexLeadingOutDaughter(Pythia8::Event* evtPtr, Pythia8::Event* evtPartonPtr, int iPart);
+int getIndexClosestHardParton(Pythia8::Event* evtPtr, double eta, double phi);
 std::vector<int> daughterList(Pythia8::Event* evtPtr, int iPart);
 std::vector<int> daughterListRecursive(Pythia8::Event* evtPtr, int iPart);
 void copyEvent(Pythia8::Event& eventSrc, Pythia8::Event& event);
@@ -400,6 +401,20 @@ int getIndexLeadingOutDaughter(Pythia8::Event* evtPtr, Pythia8::Event* evtParton
     return iOutgoing;
 }
 
+/*
+ * return index of the particle from hard scattering (index 5 or 6) that is closest to (eta, phi) in eta-phi
+ */
+int getIndexClosestHardParton(Pythia8::Event* evtPtr, double eta, double phi)
+{
+    int ip1 = 5;
+    int ip2 = 6;
+
+    double dR2parton1 = getDR2(eta, phi, (*evtPtr)[ip1].eta(), (*evtPtr)[ip1].phi());
+    double dR2parton2 = getDR2(eta, phi, (*evtPtr)[ip2].eta(), (*evtPtr)[ip2].phi());
+
+    return (dR2parton1 < dR2parton2) ? ip1 : ip2;
+}
+
 /*
  * re-implementation of the following : vector<int> Particle::daughterList();
  * uses an external Event* evtPtr, the rest is same as the original function
@@ -472,7 +487,7 @@ std::vector<int> daughterListRecursive(Pythia8::Event* evtPtr, int iPart)
         int iPartNow = daughterVec[iDau];
         Pythia8::Particle& partNow = (*evtPtr)[iPartNow];
         if (!partNow.isFinal()) {
-            vector<int> grandDauVec = daughterList(evtPtr, iPartNow);
+            std::vector<int> grandDauVec = daughterList(evtPtr, iPartNow);
             for (int i = 0; i < int(grandDauVec.size()); ++i)
                 daughterVec.push_back( grandDauVec[i] );
             size += grandDauVec.size();
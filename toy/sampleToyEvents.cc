@@ -12,6 +12,8 @@
 #include "TMath.h"
 
 #include "../utilities/particleTree.h"
+#include "../utilities/storageUtil.h"
+#include "../utilities/toyEventUtil.h"
 #include "../utilities/physicsUtil.h"
 #include "../utilities/systemUtil.h"
 #include "../utilities/ArgumentParser.h"
@@ -80,6 +82,15 @@ void sampleToyEvents(int mode, std::string outputFileName,
             std::atoi(ArgumentParser::ParseOptionInputSingle("--rndSeedCent", argOptions).c_str()) : 12345;
     int rndSeedParticle = (ArgumentParser::ParseOptionInputSingle("--rndSeedParticle", argOptions).size() > 0) ?
             std::atoi(ArgumentParser::ParseOptionInputSingle("--rndSeedParticle", argOptions).c_str()) : 6789;
+    // layout of the particle tree : 0 for vector branches, otherwise C arrays with space for this many particles
+    int flatLayout = (ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--flatLayout", argOptions).c_str()) : 0;
+    // kinematics with truncated mantissas and 8-bit charge if > 0, see utilities/precisionUtil.h
+    int reducedPrecision = (ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--reducedPrecision", argOptions).c_str()) : 0;
+    // backend of the output : TTree or RNTuple
+    std::string storage = (ArgumentParser::ParseOptionInputSingle("--storage", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--storage", argOptions) : STORAGE::BACKENDNAMES[STORAGE::kTTree];
 
     std::cout << "##### Optional Arguments #####" << std::endl;
     std::cout << "inputFile = " << inputFileName.c_str() << std::endl;
@@ -95,6 +106,9 @@ void sampleToyEvents(int mode, std::string outputFileName,
     std::cout << "partTree = " << partTreeName.c_str() << std::endl;
     std::cout << "rndSeedCent = " << rndSeedCent << std::endl;
     std::cout << "rndSeedParticle = " << rndSeedParticle << std::endl;
+    std::cout << "flatLayout = " << flatLayout << std::endl;
+    std::cout << "reducedPrecision = " << reducedPrecision << std::endl;
+    std::cout << "storage = " << storage.c_str() << std::endl;
     std::cout << "##### Optional Arguments - END #####" << std::endl;
 
     if (minMultCh > -1 && maxMultCh > 0 && mindNdEta > -1 && maxdNdEta > 0) {
@@ -107,6 +121,12 @@ void sampleToyEvents(int mode, std::string outputFileName,
         return;
     }
 
+    int iStorage = getStorageBackendIndex(storage);
+    if (iStorage < 0) {
+        std::cout << "Storage : " << storage.c_str() << " is not recognized as a valid storage backend. Exiting." << std::endl;
+        return;
+    }
+
     // Set up the ROOT TFile and TTree.
     TFile* inputFile = 0;
     if (inputFileName != "NULL") {
@@ -178,15 +198,8 @@ void sampleToyEvents(int mode, std::string outputFileName,
         }
     }
 
-    TF1* fncPt = 0;
-    std::vector<int> mults;         // {charged multiplicity, neutral multiplicity}
-    double ratioChNeutral = 0.5;
+    thermalEventSampler* thermalSampler = 0;
     if (mode == k_sampleThermalPt) {
-        // taken from https://github.com/JetQuenchingTools/JetToyHI/blob/c80710caee0c3687707e5d676f3a97dda7c73a25/include/thermalEvent.hh#L45
-        fncPt = new TF1("fncPt","[0]*TMath::Power([1], 2)*x*TMath::Exp(-[1]*x)", 0.2, 200);
-        fncPt->SetParNames("Amplitude", "b (GeV/c)^{-1}");
-        fncPt->SetParameters(1., 2./meanPt);
-
         if (minMultCh > -1 && maxMultCh > 0) {
             //
         }
@@ -195,7 +208,7 @@ void sampleToyEvents(int mode, std::string outputFileName,
             maxMultCh = (int)(maxdNdEta*2*maxEta);
         }
         nCharge = 2;
-        mults.resize(nCharge);
+        thermalSampler = new thermalEventSampler(minMultCh, maxMultCh, meanPt, maxEta, minPt);
     }
 
     std::vector<TH1D*> vecH1D_ngen;
@@ -204,21 +217,26 @@ void sampleToyEvents(int mode, std::string outputFileName,
 
     TFile* outputFile = new TFile(outputFileName.c_str(), "UPDATE");
 
-    TTree* eventInfoTree = new TTree(eventInfoTreeName.c_str(), Form("Info about %s events with Cent:%d-%d", modeLabels[mode].c_str(),
-                                                                                                             minCent, maxCent));
+    storageWriter eventInfoWriter(outputFile, eventInfoTreeName, Form("Info about %s events with Cent:%d-%d", modeLabels[mode].c_str(),
+                                                                                                              minCent, maxCent), iStorage);
     int hiBin;
-    eventInfoTree->Branch("hiBin", &hiBin);
+    eventInfoWriter.branchScalar("hiBin", &hiBin);
 
-    TTree* partTree = new TTree(partTreeName.c_str(), Form("%s particles from Cent:%d-%d", modeLabels[mode].c_str(),
-                                                                                           minCent, maxCent));
+    storageWriter partWriter(outputFile, partTreeName, Form("%s particles from Cent:%d-%d", modeLabels[mode].c_str(),
+                                                                                            minCent, maxCent), iStorage);
     particleTree partt;
-    partt.branchTree(partTree);
+    partt.setFlatLayout(flatLayout);
+    partt.setReducedPrecision(reducedPrecision);
+    partt.branchTree(partWriter);
 
-    TRandom3 rand1(rndSeedCent);
+    // counter-based generators : the random numbers for an event depend only on (seed, entry)
+    counterRNG rand1(rndSeedCent);
 
-    TRandom3 rand2(rndSeedParticle);
+    counterRNG rand2(rndSeedParticle);
 
-    gRandom->SetSeed(rndSeedParticle);
+    // TH1::GetRandom(), TH2::GetRandom2() and TF1::GetRandom() use gRandom
+    TRandom* gRandomOrig = gRandom;
+    gRandom = &rand2;
     int eventsAnalyzed = 0;
     std::cout << "nEvents = " << nEvents << std::endl;
     std::cout << "Loop STARTED" << std::endl;
@@ -228,6 +246,9 @@ void sampleToyEvents(int mode, std::string outputFileName,
           std::cout << "current entry = " <<iEvent<<" out of "<<nEvents<<" : "<<std::setprecision(2)<<(double)iEvent/nEvents*100<<" %"<<std::endl;
         }
 
+        rand1.setCounter(iEvent);
+        rand2.setCounter(iEvent);
+
         hiBin = (int)std::floor(rand1.Uniform(minCent*2, maxCent*2));
 
         partt.clearEvent();
@@ -251,6 +272,7 @@ void sampleToyEvents(int mode, std::string outputFileName,
                 int iHist_etaVSpt = iCh + iCent4*n_hiBinVSngen;
 
                 int ngen = (int)std::floor(vecH1D_ngen[iCh]->GetRandom());
+                partt.reserve(partt.n + ngen);
                 for (int i = 0; i < ngen; ++i) {
                     double eta;
                     double pt;
@@ -269,37 +291,18 @@ void sampleToyEvents(int mode, std::string outputFileName,
             }
         }
         else if (mode == k_sampleThermalPt) {
-
-            // {charged multiplicity, neutral multiplicity}
-            mults[0] = (int)(rand2.Uniform(minMultCh, maxMultCh+1));
-            mults[1] = mults[0] * ratioChNeutral;
-
-            for (int iCh = 0; iCh < nCharge; ++iCh) {
-
-                for (int i = 0; i < mults[iCh]; ++i) {
-
-                    double pt = fncPt->GetRandom();
-                    if (pt < minPt) continue;
-
-                    double eta = rand2.Uniform(-maxEta, maxEta);
-                    double phi = rand2.Uniform(-1*TMath::Pi(), TMath::Pi());
-
-                    partt.pt->push_back(pt);
-                    partt.eta->push_back(eta);
-                    partt.phi->push_back(phi);
-
-                    partt.chg->push_back(((iCh == 0) ? 1 : 0));
-                    partt.n++;
-                }
-            }
+            thermalSampler->sample(rand2, partt);
         }
 
-        eventInfoTree->Fill();
-        partTree->Fill();
+        eventInfoWriter.fill();
+        partt.encode();
+        partWriter.fill();
     }
     std::cout << "Loop ENDED" << std::endl;
     std::cout << "eventsAnalyzed = " << eventsAnalyzed << std::endl;
 
+    gRandom = gRandomOrig;
+
     for (int i = 0; i < (int)vecH1D_ngen.size(); ++i) {
         if (vecH1D_ngen[i] != 0) {
             vecH1D_ngen[i]->Delete();
@@ -311,6 +314,8 @@ void sampleToyEvents(int mode, std::string outputFileName,
         inputFile->Close();
     }
 
+    eventInfoWriter.close();
+    partWriter.close();
     outputFile->Write("", TObject::kOverwrite);
     std::cout<<"Closing the output file"<<std::endl;
     outputFile->Close();
@@ -356,6 +361,9 @@ int main(int argc, char* argv[]) {
         std::cout << "partTree=<path to tree containing particles>" << std::endl;
         std::cout << "rndSeedCent=<random number seed reserved for centrality>" << std::endl;
         std::cout << "rndSeedParticle=<random number seed reserved for particles>" << std::endl;
+        std::cout << "storage=<backend of the output : TTree or RNTuple>" << std::endl;
+        std::cout << "flatLayout=<write the particle tree with C arrays, ex. pt[n]/F, with this initial capacity if > 0>" << std::endl;
+        std::cout << "reducedPrecision=<write pt, eta, phi with truncated mantissas and the charge as 8-bit integer if > 0>" << std::endl;
 
         return 1;
     }
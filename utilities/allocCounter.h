@@ -0,0 +1,99 @@
+/*
+ * debug counter for heap allocations.
+ * Compile with -DALLOCCOUNTER to replace the global operator new with one that counts the allocations.
+ * Without ALLOCCOUNTER the counter is always 0 and the default operator new is used.
+ * getAllocCount() counts the allocations of all threads, getThreadAllocCount() those of the calling thread only,
+ * so that the allocations of ROOT's read threads do not enter the count of an event loop.
+ */
+
+#ifndef ALLOCCOUNTER_H_
+#define ALLOCCOUNTER_H_
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+bool allocCounterEnabled();
+unsigned long long getAllocCount();
+unsigned long long getThreadAllocCount();
+
+#ifdef ALLOCCOUNTER
+
+std::atomic<unsigned long long> allocCount(0);
+thread_local unsigned long long allocCountThread = 0;
+
+void* operator new(std::size_t size)
+{
+    allocCount.fetch_add(1, std::memory_order_relaxed);
+    ++allocCountThread;
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (ptr == 0) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+bool allocCounterEnabled()
+{
+    return true;
+}
+
+unsigned long long getAllocCount()
+{
+    return allocCount.load(std::memory_order_relaxed);
+}
+
+unsigned long long getThreadAllocCount()
+{
+    return allocCountThread;
+}
+
+#else
+
+bool allocCounterEnabled()
+{
+    return false;
+}
+
+unsigned long long getAllocCount()
+{
+    return 0;
+}
+
+unsigned long long getThreadAllocCount()
+{
+    return 0;
+}
+
+#endif
+
+/*
+ * counts the allocations of the calling thread in a section of code.
+ * The allocations between pause() and resume() are not counted,
+ * ex. calls into FastJet whose allocations are not owned by this project.
+ */
+class allocSection {
+public :
+    allocSection() : nStart(0), nPauseStart(0), nPaused(0) {};
+    ~allocSection(){};
+
+    void start() { nStart = getThreadAllocCount(); nPaused = 0; };
+    void pause() { nPauseStart = getThreadAllocCount(); };
+    void resume() { nPaused += getThreadAllocCount() - nPauseStart; };
+    unsigned long long count() const { return getThreadAllocCount() - nStart - nPaused; };
+
+private :
+    unsigned long long nStart;
+    unsigned long long nPauseStart;
+    unsigned long long nPaused;
+};
+
+#endif /* ALLOCCOUNTER_H_ */
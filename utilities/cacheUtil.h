@@ -0,0 +1,126 @@
+/*
+ * utilities to cache the output of a job in its output file.
+ * A job writes a key together with its output. The key contains everything that the output depends on,
+ * ex. checksum of the input file, parameters, checksum of the executable.
+ * A later job with the same key can skip the processing.
+ */
+
+#ifndef CACHEUTIL_H_
+#define CACHEUTIL_H_
+
+#include "TFile.h"
+#include "TMD5.h"
+#include "TNamed.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+std::string getMD5(std::string str);
+std::string getFileMD5(std::string filePath);
+std::string getFileMD5(std::string filePath, TFile* memoFile);
+std::string getExecutableMD5();
+bool isCached(TFile* file, std::string keyName, std::string key, std::vector<std::string> objNames);
+void writeCacheKey(TFile* file, std::string keyName, std::string key);
+
+std::string getMD5(std::string str)
+{
+    TMD5 md5;
+    md5.Update((const UChar_t*)str.c_str(), str.size());
+    md5.Final();
+    return md5.AsString();
+}
+
+/*
+ * returns the checksum of the file content, "NULL" if the file cannot be read
+ */
+std::string getFileMD5(std::string filePath)
+{
+    TMD5* md5 = TMD5::FileChecksum(filePath.c_str());
+    if (md5 == 0) return "NULL";
+
+    std::string res = md5->AsString();
+    delete md5;
+    return res;
+}
+
+/*
+ * same as getFileMD5(filePath), but the checksum is memoized in "memoFile" together with the size and
+ * the modification time of the file. It is recomputed only if one of them has changed.
+ * The memo is the title of the object "fileMD5Memo", one line "path<TAB>size<TAB>mtime<TAB>checksum" per file.
+ */
+std::string getFileMD5(std::string filePath, TFile* memoFile)
+{
+    FileStat_t fileStat;
+    if (gSystem->GetPathInfo(filePath.c_str(), fileStat) != 0) return getFileMD5(filePath);
+    std::string fileId = Form("%s\t%lld\t%ld", filePath.c_str(), fileStat.fSize, fileStat.fMtime);
+
+    std::string memo = "";
+    TNamed* memoObj = (memoFile != 0) ? (TNamed*)memoFile->Get("fileMD5Memo") : 0;
+    if (memoObj != 0) memo = memoObj->GetTitle();
+
+    // lines of the other files are kept, the line of this file is replaced
+    std::string memoNew = "";
+    std::istringstream memoLines(memo);
+    std::string line;
+    while (std::getline(memoLines, line)) {
+        size_t posMD5 = line.rfind("\t");
+        if (posMD5 == std::string::npos) continue;
+
+        if (line.substr(0, posMD5) == fileId) return line.substr(posMD5 + 1);
+        if (line.find(filePath + "\t") == 0) continue;
+        memoNew.append(line + "\n");
+    }
+
+    std::string res = getFileMD5(filePath);
+    if (res == "NULL" || memoFile == 0 || !memoFile->IsWritable()) return res;
+
+    memoNew.append(fileId + "\t" + res + "\n");
+    memoFile->cd();
+    TNamed memoObjNew("fileMD5Memo", memoNew.c_str());
+    memoObjNew.Write("", TObject::kOverwrite);
+    return res;
+}
+
+/*
+ * checksum of the running executable, it changes whenever the code is recompiled with changes.
+ * The compilation time is used if the executable cannot be read (/proc is specific to Linux).
+ */
+std::string getExecutableMD5()
+{
+    std::string res = getFileMD5("/proc/self/exe");
+    if (res == "NULL") {
+        res = getMD5(Form("%s %s", __DATE__, __TIME__));
+    }
+    return res;
+}
+
+/*
+ * returns true if "file" has a key object named "keyName" with value "key" and the objects in "objNames"
+ */
+bool isCached(TFile* file, std::string keyName, std::string key, std::vector<std::string> objNames)
+{
+    TNamed* cacheKey = (TNamed*)file->Get(keyName.c_str());
+    if (cacheKey == 0) return false;
+    if (key != cacheKey->GetTitle()) return false;
+
+    for (int i = 0; i < (int)objNames.size(); ++i) {
+        if (file->Get(objNames[i].c_str()) == 0) return false;
+    }
+
+    return true;
+}
+
+/*
+ * writes the key as the title of a TNamed object, an existing key with the same name is overwritten
+ */
+void writeCacheKey(TFile* file, std::string keyName, std::string key)
+{
+    file->cd();
+    TNamed cacheKey(keyName.c_str(), key.c_str());
+    cacheKey.Write("", TObject::kOverwrite);
+}
+
+#endif /* CACHEUTIL_H_ */
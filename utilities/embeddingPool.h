@@ -0,0 +1,166 @@
+/*
+ * pool of background events kept in memory for embedding.
+ * The events are loaded once from a particleTree or generated with thermalEventSampler,
+ * then a background event is picked for each signal event instead of reading an entry-aligned background tree.
+ */
+
+#ifndef EMBEDDINGPOOL_H_
+#define EMBEDDINGPOOL_H_
+
+#include "TTree.h"
+#include "TMath.h"
+
+#include "particleTree.h"
+#include "physicsUtil.h"
+#include "toyEventUtil.h"
+
+#include <vector>
+
+class embeddingPool {
+public :
+    embeddingPool(UInt_t seed = 0, bool rotatePhi = false);
+    ~embeddingPool(){};
+
+    int load(TTree* t, int maxEvents = -1);
+    int generate(thermalEventSampler& sampler, int nEvents, UInt_t seed);
+    particleTree& getEvent(ULong64_t entry);
+    int size() const { return (int)offsets.size() - 1; };
+
+    bool rotatePhi;     // rotate the picked event by a random angle in phi
+    int iPicked;        // index of the last picked event in the pool
+    double dPhiPicked;  // rotation angle of the last picked event
+
+private :
+    void appendEvent(particleTree& particles);
+
+    // all events in contiguous arrays, particles of event i are in [offsets[i], offsets[i+1])
+    std::vector<int> offsets;
+    std::vector<float> pt;
+    std::vector<float> eta;
+    std::vector<float> phi;
+    std::vector<float> chg;
+
+    counterRNG rand;
+    particleTree event;     // picked event
+};
+
+/*
+ * the picks use stream 1 of the seed, stream 0 is used by generate()
+ */
+embeddingPool::embeddingPool(UInt_t seed, bool rotatePhi_) : rand(seed, 1)
+{
+    rotatePhi = rotatePhi_;
+    iPicked = -1;
+    dPhiPicked = 0;
+
+    offsets.push_back(0);
+
+    event.pt = new std::vector<float>();
+    event.eta = new std::vector<float>();
+    event.phi = new std::vector<float>();
+    event.chg = new std::vector<float>();
+    event.clearEvent();
+}
+
+/*
+ * the first n entries of the vectors are used
+ */
+void embeddingPool::appendEvent(particleTree& particles)
+{
+    int n = particles.n;
+    pt.insert(pt.end(), particles.pt->begin(), particles.pt->begin() + n);
+    eta.insert(eta.end(), particles.eta->begin(), particles.eta->begin() + n);
+    phi.insert(phi.end(), particles.phi->begin(), particles.phi->begin() + n);
+    chg.insert(chg.end(), particles.chg->begin(), particles.chg->begin() + n);
+    offsets.push_back(pt.size());
+}
+
+/*
+ * copies the first "maxEvents" events of a particleTree into the pool, all events if maxEvents < 0
+ * returns the number of events in the pool
+ */
+int embeddingPool::load(TTree* t, int maxEvents)
+{
+    particleTree particles;
+    particles.setupTreeForReading(t);
+
+    int nEntries = t->GetEntries();
+    if (maxEvents >= 0 && maxEvents < nEntries) nEntries = maxEvents;
+
+    for (int i = 0; i < nEntries; ++i) {
+        t->GetEntry(i);
+        particles.decode();
+        appendEvent(particles);
+    }
+    t->ResetBranchAddresses();
+
+    return size();
+}
+
+/*
+ * generates "nEvents" thermal events into the pool, event i uses the random numbers for (seed, stream 0, i)
+ * returns the number of events in the pool
+ */
+int embeddingPool::generate(thermalEventSampler& sampler, int nEvents, UInt_t seed)
+{
+    counterRNG randSample(seed);
+
+    particleTree particles;
+    particles.pt = new std::vector<float>();
+    particles.eta = new std::vector<float>();
+    particles.phi = new std::vector<float>();
+    particles.chg = new std::vector<float>();
+
+    for (int i = 0; i < nEvents; ++i) {
+        particles.clearEvent();
+        randSample.setCounter(i);
+        sampler.sample(randSample, particles);
+        appendEvent(particles);
+    }
+
+    delete particles.pt;
+    delete particles.eta;
+    delete particles.phi;
+    delete particles.chg;
+
+    return size();
+}
+
+/*
+ * returns the background event for the signal event "entry".
+ * The choice and the rotation depend only on (seed, stream 1, entry), not on the order in which the events are processed.
+ * The returned object is overwritten by the next call.
+ */
+particleTree& embeddingPool::getEvent(ULong64_t entry)
+{
+    event.clearEvent();
+
+    int nPool = size();
+    if (nPool <= 0) return event;
+
+    rand.setCounter(entry);
+    iPicked = (int)(rand.Rndm() * nPool);
+    if (iPicked >= nPool) iPicked = nPool - 1;
+    dPhiPicked = rotatePhi ? rand.Uniform(-1*TMath::Pi(), TMath::Pi()) : 0;
+
+    int iStart = offsets[iPicked];
+    int iEnd = offsets[iPicked+1];
+
+    event.pt->assign(pt.begin() + iStart, pt.begin() + iEnd);
+    event.eta->assign(eta.begin() + iStart, eta.begin() + iEnd);
+    event.chg->assign(chg.begin() + iStart, chg.begin() + iEnd);
+    if (rotatePhi) {
+        event.phi->resize(iEnd - iStart);
+        for (int i = iStart; i < iEnd; ++i) {
+            (*event.phi)[i - iStart] = correctPhiRange(phi[i] + dPhiPicked);
+        }
+    }
+    else {
+        event.phi->assign(phi.begin() + iStart, phi.begin() + iEnd);
+    }
+    event.n = iEnd - iStart;
+
+    return event;
+}
+
+#endif /* EMBEDDINGPOOL_H_ */
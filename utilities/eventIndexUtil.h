@@ -0,0 +1,264 @@
+/*
+ * per-event index of an event file, a small sidecar tree with one entry per event (written by pythia82/indexEvents.cc).
+ * The entries are aligned with the event trees, so the entry numbers selected in the index are entry numbers of the events.
+ * The index is queried with a TTree::Draw() selection on its branches, ex. an isolated photon above 100 GeV
+ * with a back-to-back jet :
+ *     "phopt > 100 && phoiso < 5 && leadjetpt > 30 && abs(abs(phophi - leadjetphi) - TMath::Pi()) < 0.4"
+ * The jobs read only the selected events with options --eventIndex and --indexSelection, see eventIndexSelection.
+ */
+
+#ifndef EVENTINDEXUTIL_H_
+#define EVENTINDEXUTIL_H_
+
+#include "TChain.h"
+#include "TEntryList.h"
+#include "TTree.h"
+
+#include "inputFilesUtil.h"
+#include "systemUtil.h"
+#include "ArgumentParser.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace EVENTINDEX {
+
+const std::string treeName = "evtIndex";
+const std::string treeTitle = "per-event index of the events";
+
+};
+
+class eventIndexTree {
+public :
+    eventIndexTree() {
+        clear();
+    };
+    ~eventIndexTree(){};
+    void clear();
+    void branchTree(TTree* t);
+    void setupTreeForReading(TTree* t);
+
+    // Declaration of leaf types
+    Int_t code;            // Pythia process code
+    Float_t q;             // factorization scale Q
+    Float_t partonpt[2];   // outgoing partons of the hard scattering, index 5 and 6 of the event record
+    Float_t partoneta[2];
+    Float_t partonphi[2];
+    Int_t partonid[2];
+    Int_t nJet;            // number of jets, -1 if there is no jet tree
+    Float_t leadjetpt;
+    Float_t leadjeteta;
+    Float_t leadjetphi;
+    Float_t phopt;         // hardest final photon, pt is -1 if there is none
+    Float_t phoeta;
+    Float_t phophi;
+    Float_t phoiso;        // isolation Et of the photon within dR < 0.4
+    Float_t zpt;           // hardest Z boson, pt is -1 if there is none
+    Float_t zeta;
+    Float_t zphi;
+};
+
+std::string getEventIndexName(std::string eventFileName);
+TEntryList* queryEventIndex(const std::vector<std::string>& indexFiles, std::string selection);
+void setPartialEventIndex(std::vector<std::string>& argOptions, int iFile);
+
+void eventIndexTree::clear()
+{
+    code = -1;
+    q = -1;
+    for (int i = 0; i < 2; ++i) {
+        partonpt[i] = -1;
+        partoneta[i] = -999999;
+        partonphi[i] = -999999;
+        partonid[i] = 0;
+    }
+    nJet = -1;
+    leadjetpt = -1;
+    leadjeteta = -999999;
+    leadjetphi = -999999;
+    phopt = -1;
+    phoeta = -999999;
+    phophi = -999999;
+    phoiso = -1;
+    zpt = -1;
+    zeta = -999999;
+    zphi = -999999;
+}
+
+void eventIndexTree::branchTree(TTree* t)
+{
+    t->Branch("code", &code, "code/I");
+    t->Branch("q", &q, "q/F");
+    t->Branch("partonpt", partonpt, "partonpt[2]/F");
+    t->Branch("partoneta", partoneta, "partoneta[2]/F");
+    t->Branch("partonphi", partonphi, "partonphi[2]/F");
+    t->Branch("partonid", partonid, "partonid[2]/I");
+    t->Branch("nJet", &nJet, "nJet/I");
+    t->Branch("leadjetpt", &leadjetpt, "leadjetpt/F");
+    t->Branch("leadjeteta", &leadjeteta, "leadjeteta/F");
+    t->Branch("leadjetphi", &leadjetphi, "leadjetphi/F");
+    t->Branch("phopt", &phopt, "phopt/F");
+    t->Branch("phoeta", &phoeta, "phoeta/F");
+    t->Branch("phophi", &phophi, "phophi/F");
+    t->Branch("phoiso", &phoiso, "phoiso/F");
+    t->Branch("zpt", &zpt, "zpt/F");
+    t->Branch("zeta", &zeta, "zeta/F");
+    t->Branch("zphi", &zphi, "zphi/F");
+}
+
+void eventIndexTree::setupTreeForReading(TTree* t)
+{
+    t->SetBranchAddress("code", &code);
+    t->SetBranchAddress("q", &q);
+    t->SetBranchAddress("partonpt", partonpt);
+    t->SetBranchAddress("partoneta", partoneta);
+    t->SetBranchAddress("partonphi", partonphi);
+    t->SetBranchAddress("partonid", partonid);
+    t->SetBranchAddress("nJet", &nJet);
+    t->SetBranchAddress("leadjetpt", &leadjetpt);
+    t->SetBranchAddress("leadjeteta", &leadjeteta);
+    t->SetBranchAddress("leadjetphi", &leadjetphi);
+    t->SetBranchAddress("phopt", &phopt);
+    t->SetBranchAddress("phoeta", &phoeta);
+    t->SetBranchAddress("phophi", &phophi);
+    t->SetBranchAddress("phoiso", &phoiso);
+    t->SetBranchAddress("zpt", &zpt);
+    t->SetBranchAddress("zeta", &zeta);
+    t->SetBranchAddress("zphi", &zphi);
+}
+
+/*
+ * ex. eventFileName = "events.root" gives "events_index.root"
+ */
+std::string getEventIndexName(std::string eventFileName)
+{
+    std::string suffix = ".root";
+    std::string base = eventFileName;
+    if (endsWith(base, suffix)) {
+        base = base.substr(0, base.size() - suffix.size());
+    }
+    return Form("%s_index%s", base.c_str(), suffix.c_str());
+}
+
+/*
+ * returns the entries of the index files, read as one TChain, which pass "selection".
+ * The entry numbers are those of the chain, so they match the events if the event files are in the same order.
+ * Returns 0 if the index cannot be read or the selection is not valid.
+ */
+TEntryList* queryEventIndex(const std::vector<std::string>& indexFiles, std::string selection)
+{
+    TChain* chain = openChain(indexFiles, EVENTINDEX::treeName);
+    if (chain == 0) return 0;
+
+    // the entry numbers of all selected entries are kept in memory, one double per entry
+    Long64_t nEntries = chain->GetEntries();
+    chain->SetEstimate(nEntries + 1);
+    // Entry$ is the entry number in the chain, not in the current file
+    Long64_t nSelected = chain->Draw("Entry$", selection.c_str(), "goff");
+    if (nSelected < 0) {
+        std::cout << "ERROR : selection " << selection.c_str() << " cannot be applied to the event index." << std::endl;
+        delete chain;
+        return 0;
+    }
+
+    TEntryList* entryList = new TEntryList("eventIndexSelection", selection.c_str());
+    // not written to the output file
+    entryList->SetDirectory(0);
+    double* entries = chain->GetV1();
+    for (Long64_t i = 0; i < nSelected; ++i) {
+        entryList->Enter((Long64_t)entries[i]);
+    }
+    std::cout << "event index : " << nSelected << " out of " << nEntries << " events pass " << selection.c_str() << std::endl;
+
+    delete chain;
+    return entryList;
+}
+
+/*
+ * sets option --eventIndex of the partial job of input file "iFile" (see runPartialJobs()) to the index of that file
+ */
+void setPartialEventIndex(std::vector<std::string>& argOptions, int iFile)
+{
+    std::string eventIndex = ArgumentParser::ParseOptionInputSingle("--eventIndex", argOptions);
+    if (eventIndex.size() == 0) return;
+
+    std::vector<std::string> indexFiles = expandInputFiles(eventIndex);
+    if (iFile < (int)indexFiles.size()) setOption(argOptions, "--eventIndex", indexFiles[iFile]);
+}
+
+/*
+ * the selection of events from the event index, common to the jobs reading events.
+ * The entry list is 0 if there is no selection, then every event passes.
+ */
+class eventIndexSelection {
+public :
+    eventIndexSelection() : eventIndex("NULL"), indexSelection(""), entryList(0) {};
+    ~eventIndexSelection(){ delete entryList; };
+
+    void parseOptions(const std::vector<std::string>& argOptions);
+    void printOptions() const;
+    void printUsage() const;
+    bool init(Long64_t nEvents);
+    bool passed(Long64_t iEvent) const;
+
+    std::string eventIndex;       // index files, a list in any format of expandInputFiles()
+    std::string indexSelection;   // selection on the branches of the index
+
+    TEntryList* entryList;
+};
+
+void eventIndexSelection::parseOptions(const std::vector<std::string>& argOptions)
+{
+    eventIndex = (ArgumentParser::ParseOptionInputSingle("--eventIndex", argOptions).size() > 0) ?
+            ArgumentParser::ParseOptionInputSingle("--eventIndex", argOptions) : "NULL";
+    indexSelection = ArgumentParser::ParseOptionInputSingle("--indexSelection", argOptions);
+}
+
+/*
+ * lines for the "Optional Arguments" block of the job
+ */
+void eventIndexSelection::printOptions() const
+{
+    std::cout << "eventIndex = " << eventIndex.c_str() << std::endl;
+    std::cout << "indexSelection = " << indexSelection.c_str() << std::endl;
+}
+
+/*
+ * lines for the "Options are" list of the usage message
+ */
+void eventIndexSelection::printUsage() const
+{
+    std::cout << "--eventIndex=<index files of the event files, in the same order, written by indexEvents.exe>" << std::endl;
+    std::cout << "--indexSelection=<selection on the index branches, only the events passing it are read>" << std::endl;
+}
+
+/*
+ * runs the query, "nEvents" is the number of events of the job, the index must have the same number of entries.
+ * Returns false if there is a selection and it cannot be applied.
+ */
+bool eventIndexSelection::init(Long64_t nEvents)
+{
+    if (eventIndex == "NULL" || indexSelection.size() == 0) return true;
+
+    std::vector<std::string> indexFiles = expandInputFiles(eventIndex);
+    TChain* chain = openChain(indexFiles, EVENTINDEX::treeName);
+    if (chain == 0) return false;
+    Long64_t nEntries = chain->GetEntries();
+    delete chain;
+    if (nEntries != nEvents) {
+        std::cout << "ERROR : event index has " << nEntries << " entries, but there are " << nEvents << " events." << std::endl;
+        return false;
+    }
+
+    entryList = queryEventIndex(indexFiles, indexSelection);
+    return (entryList != 0);
+}
+
+bool eventIndexSelection::passed(Long64_t iEvent) const
+{
+    if (entryList == 0) return true;
+    return entryList->Contains(iEvent);
+}
+
+#endif /* EVENTINDEXUTIL_H_ */
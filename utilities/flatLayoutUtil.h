@@ -0,0 +1,149 @@
+/*
+ * utilities for the flat layout of trees.
+ * In the flat layout a variable size array is written as a C array whose size is given by a counter branch,
+ * ex. "pt[n]/F", instead of a std::vector<float>. A C array has no per-entry collection header and no allocation on read.
+ * The std::vector members of the tree classes stay as the interface for both layouts. In the flat layout the storage of
+ * the vector is used as the C array for writing, the branches are pointed to the current storage before each Fill().
+ * For reading, the C array is read into a separate buffer and copied into the vector after GetEntry(),
+ * so the size of the vector is the counter value as in the vector layout.
+ */
+
+#ifndef FLATLAYOUTUTIL_H_
+#define FLATLAYOUTUTIL_H_
+
+#include <TTree.h>
+#include <TChain.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TString.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
+inline const char* getLeafTypeCode(std::vector<float>*) { return "F"; }
+inline const char* getLeafTypeCode(std::vector<int>*) { return "I"; }
+inline const char* getLeafTypeCode(std::vector<char>*) { return "B"; }
+bool isFlatBranch(TTree* t, const char* name);
+int getFlatCapacity(TTree* t, const char* name);
+
+/*
+ * creates the branch "name[counterName]/X" which uses the storage of "v" as the C array
+ */
+template <typename T>
+TBranch* branchFlat(TTree* t, const char* name, const char* counterName, std::vector<T>*& v, int capacity)
+{
+    if (v == 0) v = new std::vector<T>();
+    v->reserve(capacity);
+    return t->Branch(name, (void*)v->data(), Form("%s[%s]/%s", name, counterName, getLeafTypeCode(v)));
+}
+
+/*
+ * makes sure that "v" has space for "capacity" entries and that branch "b" points to the current storage of "v".
+ * returns true if the branch had to be pointed to a new storage.
+ */
+template <typename T>
+bool bindFlat(TBranch* b, std::vector<T>* v, int capacity)
+{
+    if (b == 0 || v == 0) return false;
+
+    v->reserve(capacity);
+    if (b->GetAddress() == (char*)v->data()) return false;
+
+    b->SetAddress((void*)v->data());
+    return true;
+}
+
+/*
+ * read buffers of the flat branches of a tree class, copy() must be called after each GetEntry()
+ */
+class flatReadBuffers {
+public :
+    flatReadBuffers(){};
+    ~flatReadBuffers(){};
+
+    template <typename T>
+    void setBranchAddress(TTree* t, const char* name, std::vector<T>*& v, TBranch** b);
+    void copy(int n);
+
+private :
+    // copies the first n entries of a buffer into its vector
+    std::vector<std::function<void(int)> > copies;
+};
+
+/*
+ * reads the C array of branch "name" into a buffer with space for the maximum array size in the tree
+ */
+template <typename T>
+void flatReadBuffers::setBranchAddress(TTree* t, const char* name, std::vector<T>*& v, TBranch** b)
+{
+    if (v == 0) v = new std::vector<T>();
+
+    int capacity = getFlatCapacity(t, name);
+    std::shared_ptr<std::vector<T> > buffer = std::make_shared<std::vector<T> >(capacity);
+    // the copies do not allocate
+    v->reserve(capacity);
+    t->SetBranchAddress(name, buffer->data(), b);
+
+    std::vector<T>* dest = v;
+    copies.push_back([buffer, dest](int n) {
+        dest->assign(buffer->begin(), buffer->begin() + std::min(std::max(n, 0), (int)buffer->size()));
+    });
+}
+
+/*
+ * sets the size of the vectors to "n", the counter value of the current entry, and copies the arrays of the entry into them
+ */
+void flatReadBuffers::copy(int n)
+{
+    for (int i = 0; i < (int)copies.size(); ++i) {
+        copies[i](n);
+    }
+}
+
+/*
+ * sets the address of branch "name" for both layouts, nothing is done if the tree does not have the branch.
+ * For the flat layout, the branch is read into a buffer of "buffers", see flatReadBuffers::copy().
+ */
+template <typename T>
+void setBranchAddressAnyLayout(TTree* t, const char* name, std::vector<T>*& v, TBranch** b, flatReadBuffers& buffers)
+{
+    if (!t->GetBranch(name)) return;
+
+    if (isFlatBranch(t, name)) {
+        buffers.setBranchAddress(t, name, v, b);
+    }
+    else {
+        t->SetBranchAddress(name, &v, b);
+    }
+}
+
+/*
+ * returns true if branch "name" is a C array with a counter
+ */
+bool isFlatBranch(TTree* t, const char* name)
+{
+    TBranch* b = t->GetBranch(name);
+    if (b == 0) return false;
+
+    TLeaf* leaf = b->GetLeaf(name);
+    return (leaf != 0 && leaf->GetLeafCount() != 0);
+}
+
+/*
+ * returns the maximum array size of the flat branch "name"
+ */
+int getFlatCapacity(TTree* t, const char* name)
+{
+    TLeaf* leafCount = t->GetBranch(name)->GetLeaf(name)->GetLeafCount();
+    int res = leafCount->GetMaximum();
+    // the leaf of a chain belongs to the current tree only, the maximum over all trees is needed
+    if (t->InheritsFrom(TChain::Class())) {
+        res = std::max(res, (int)t->GetMaximum(leafCount->GetName()));
+    }
+
+    return std::max(res, 1);
+}
+
+#endif /* FLATLAYOUTUTIL_H_ */
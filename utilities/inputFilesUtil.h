@@ -0,0 +1,310 @@
+/*
+ * input files of a job given as a list :
+ *  - comma separated paths, ex. "events_1.root,events_2.root",
+ *  - wildcards, ex. "events_*.root", expanded with glob(3),
+ *  - text files ending with ".list" or ".txt" with one path per line, empty lines and lines starting with "#" are skipped.
+ * Remote paths (ex. "root://...") are used as they are.
+ * The trees of the files are read as one TChain, the entry numbers of trees read in lockstep (ex. events and jets)
+ * stay aligned if both lists have the same files in the same order.
+ *
+ * The files can also be processed concurrently, see runPartialJobs() : a child process is forked for each input file,
+ * at most nParallel at a time, and writes its output into a partial file. The partial files are merged with TFileMerger.
+ * An analysis which normalizes its histograms at the end writes the histograms before normalization into the partial
+ * files (option --partialOutput), then it is run once more without the event loop to add the merged histograms
+ * (option --mergePartials) and normalize them.
+ */
+
+#ifndef INPUTFILESUTIL_H_
+#define INPUTFILESUTIL_H_
+
+#include "TFile.h"
+#include "TChain.h"
+#include "TDirectory.h"
+#include "TFileMerger.h"
+#include "TH1.h"
+#include "TKey.h"
+#include "TList.h"
+
+#include "systemUtil.h"
+
+#include <glob.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+std::vector<std::string> expandInputFiles(std::string input);
+TChain* openChain(const std::vector<std::string>& filePaths, std::string treePath);
+std::vector<Long64_t> getEntryOffsets(const std::vector<std::string>& filePaths, std::string treePath);
+std::string getPartialOutputName(std::string outputFileName, int iFile);
+void setOption(std::vector<std::string>& options, std::string optionType, std::string value);
+bool runPartialJobs(int nFiles, int nParallel, std::string outputFileName, std::string mergedFileName, bool update,
+                    std::function<void(int, std::string)> job);
+bool mergePartialFiles(const std::vector<std::string>& partialFiles, std::string mergedFileName, bool update);
+void addPartialHistograms(TDirectory* dir, std::string mergedFileName);
+
+/*
+ * returns the list of files in "input", see the top of the file for the accepted formats
+ */
+std::vector<std::string> expandInputFiles(std::string input)
+{
+    std::vector<std::string> res;
+
+    // split() returns nothing if there is no delimiter
+    std::vector<std::string> items = (input.find(",") != std::string::npos) ? split(input, ",", false)
+                                                                            : std::vector<std::string>({input});
+    for (int i = 0; i < (int)items.size(); ++i) {
+
+        std::string item = trim(items[i]);
+        if (item.size() == 0) continue;
+
+        if (item.find("://") != std::string::npos) {
+            res.push_back(item);
+        }
+        else if (endsWith(item, ".list") || endsWith(item, ".txt")) {
+            std::ifstream listFile(item.c_str());
+            if (!listFile) {
+                std::cout << "WARNING : list of input files " << item.c_str() << " cannot be read." << std::endl;
+                continue;
+            }
+            std::string line;
+            while (std::getline(listFile, line)) {
+                line = trim(line);
+                if (line.size() == 0 || line.find("#") == 0) continue;
+
+                std::vector<std::string> filesInLine = expandInputFiles(line);
+                res.insert(res.end(), filesInLine.begin(), filesInLine.end());
+            }
+        }
+        else if (item.find_first_of("*?[") != std::string::npos) {
+            glob_t globRes;
+            if (glob(item.c_str(), 0, 0, &globRes) == 0) {
+                // glob(3) sorts the paths
+                for (int j = 0; j < (int)globRes.gl_pathc; ++j) {
+                    res.push_back(globRes.gl_pathv[j]);
+                }
+            }
+            else {
+                std::cout << "WARNING : no input file matches " << item.c_str() << std::endl;
+            }
+            globfree(&globRes);
+        }
+        else {
+            res.push_back(item);
+        }
+    }
+
+    return res;
+}
+
+/*
+ * returns the TChain of tree "treePath" in "filePaths", 0 if a file does not have the tree.
+ * A missing tree is an error as it would shift the entries of the trees read in lockstep.
+ */
+TChain* openChain(const std::vector<std::string>& filePaths, std::string treePath)
+{
+    if (filePaths.size() == 0) return 0;
+
+    TChain* chain = new TChain(treePath.c_str());
+    for (int i = 0; i < (int)filePaths.size(); ++i) {
+        // with 0 entries, the file is opened to check that it has the tree
+        if (chain->Add(filePaths[i].c_str(), 0) == 0) {
+            std::cout << "ERROR : " << treePath.c_str() << " is not found in file " << filePaths[i].c_str() << std::endl;
+            delete chain;
+            return 0;
+        }
+    }
+    return chain;
+}
+
+/*
+ * returns the entry number in the TChain of tree "treePath" of the first entry of each file in "filePaths",
+ * ex. so that the partial job of a file numbers its entries as the job over all files does.
+ * Returns an empty list if a file does not have the tree.
+ */
+std::vector<Long64_t> getEntryOffsets(const std::vector<std::string>& filePaths, std::string treePath)
+{
+    std::vector<Long64_t> res;
+
+    TChain* chain = openChain(filePaths, treePath);
+    if (chain == 0) return res;
+
+    // the number of entries of each file is read when the file is added to the chain
+    Long64_t* treeOffsets = chain->GetTreeOffset();
+    res.assign(treeOffsets, treeOffsets + filePaths.size());
+
+    delete chain;
+    return res;
+}
+
+/*
+ * ex. outputFileName = "out.root", iFile = 2 gives "out_part2.root".
+ * iFile < 0 gives the name of the merged partial files, "out_partials.root"
+ */
+std::string getPartialOutputName(std::string outputFileName, int iFile)
+{
+    std::string suffix = ".root";
+    std::string base = outputFileName;
+    if (endsWith(base, suffix)) {
+        base = base.substr(0, base.size() - suffix.size());
+    }
+    if (iFile < 0) return Form("%s_partials%s", base.c_str(), suffix.c_str());
+    return Form("%s_part%d%s", base.c_str(), iFile, suffix.c_str());
+}
+
+/*
+ * sets the value of option "optionType" in "options", ex. setOption(options, "--particleFile", "events_2.root").
+ * The previous value of the option is removed.
+ */
+void setOption(std::vector<std::string>& options, std::string optionType, std::string value)
+{
+    std::string prefix = optionType + "=";
+    for (int i = (int)options.size() - 1; i >= 0; --i) {
+        if (options[i].find(prefix) == 0) options.erase(options.begin() + i);
+    }
+    options.push_back(prefix + value);
+}
+
+/*
+ * runs "job(iFile, partialFileName)" for each of the "nFiles" input files, in at most "nParallel" child processes at a time.
+ * The partial files are merged into "mergedFileName" and deleted.
+ * If "update" is true, the objects of the partial files replace the objects with the same name in "mergedFileName"
+ * and the other objects in it are kept, otherwise "mergedFileName" is recreated.
+ * The files opened by the parent must be closed before the call, so the child processes do not share ROOT objects with it.
+ * Returns false if a job fails or the merging fails.
+ */
+bool runPartialJobs(int nFiles, int nParallel, std::string outputFileName, std::string mergedFileName, bool update,
+                    std::function<void(int, std::string)> job)
+{
+    std::cout << "##### Partial jobs #####" << std::endl;
+    std::cout << "nFiles = " << nFiles << std::endl;
+    std::cout << "nParallel = " << nParallel << std::endl;
+
+    std::vector<std::string> partialFiles;
+    for (int i = 0; i < nFiles; ++i) {
+        partialFiles.push_back(getPartialOutputName(outputFileName, i));
+        // a partial file from a previous job must not be updated
+        std::remove(partialFiles[i].c_str());
+    }
+
+    int nRunning = 0;
+    int nFailed = 0;
+    int status = 0;
+    std::cout.flush();
+    for (int i = 0; i < nFiles; ++i) {
+
+        if (nRunning >= nParallel) {
+            if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) nFailed++;
+            nRunning--;
+        }
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            std::cout << "ERROR : cannot fork the job for input file " << i << std::endl;
+            nFailed++;
+            continue;
+        }
+        if (pid == 0) {
+            job(i, partialFiles[i]);
+            std::cout.flush();
+            // exit without running the destructors and atexit handlers of the parent's objects
+            _exit(fileExists(partialFiles[i]) ? 0 : 1);
+        }
+        nRunning++;
+        std::cout << "started the job for input file " << i << ", pid = " << pid << std::endl;
+    }
+    while (nRunning > 0) {
+        if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) nFailed++;
+        nRunning--;
+    }
+
+    std::cout << "failed jobs = " << nFailed << std::endl;
+    bool res = (nFailed == 0);
+    if (res) {
+        res = mergePartialFiles(partialFiles, mergedFileName, update);
+    }
+    for (int i = 0; i < nFiles; ++i) {
+        std::remove(partialFiles[i].c_str());
+    }
+    std::cout << "##### Partial jobs - END #####" << std::endl;
+
+    return res;
+}
+
+/*
+ * merges the histograms and trees of "partialFiles" into "mergedFileName", see runPartialJobs() for "update"
+ */
+bool mergePartialFiles(const std::vector<std::string>& partialFiles, std::string mergedFileName, bool update)
+{
+    if (partialFiles.size() == 0) return false;
+
+    if (update && fileExists(mergedFileName)) {
+        // otherwise the incremental merge would add the partial objects to the old objects with the same name
+        TFile* mergedFile = TFile::Open(mergedFileName.c_str(), "UPDATE");
+        TFile* partialFile = TFile::Open(partialFiles[0].c_str(), "READ");
+        if (mergedFile == 0 || partialFile == 0) return false;
+
+        TIter next(partialFile->GetListOfKeys());
+        TKey* key = 0;
+        while ((key = (TKey*)next())) {
+            mergedFile->Delete(Form("%s;*", key->GetName()));
+        }
+        partialFile->Close();
+        mergedFile->Close();
+    }
+
+    TFileMerger merger(false);
+    if (!merger.OutputFile(mergedFileName.c_str(), (update) ? "UPDATE" : "RECREATE")) return false;
+    for (int i = 0; i < (int)partialFiles.size(); ++i) {
+        merger.AddFile(partialFiles[i].c_str());
+    }
+
+    int mergeType = TFileMerger::kAll;
+    if (update) mergeType |= TFileMerger::kIncremental;
+    bool res = merger.PartialMerge(mergeType);
+    std::cout << "merged " << partialFiles.size() << " partial files into " << mergedFileName.c_str()
+              << ((res) ? "" : " : FAILED") << std::endl;
+    return res;
+}
+
+/*
+ * adds the histograms of "mergedFileName" into the histograms with the same name in "dir".
+ * "dir" is the current directory again at return, so the histograms created later are written into it.
+ */
+void addPartialHistograms(TDirectory* dir, std::string mergedFileName)
+{
+    TFile* mergedFile = TFile::Open(mergedFileName.c_str(), "READ");
+    if (mergedFile == 0) {
+        std::cout << "ERROR : merged partial file " << mergedFileName.c_str() << " cannot be read." << std::endl;
+        dir->cd();
+        return;
+    }
+
+    int nAdded = 0;
+    TIter next(mergedFile->GetListOfKeys());
+    TKey* key = 0;
+    while ((key = (TKey*)next())) {
+        TObject* obj = key->ReadObj();
+        if (obj == 0 || !obj->InheritsFrom(TH1::Class())) continue;
+
+        TH1* h = (TH1*)dir->Get(key->GetName());
+        if (h == 0) {
+            std::cout << "WARNING : " << key->GetName() << " of the partial files is not found in the output." << std::endl;
+            continue;
+        }
+        h->Add((TH1*)obj);
+        nAdded++;
+    }
+    std::cout << "added " << nAdded << " histograms from " << mergedFileName.c_str() << std::endl;
+
+    mergedFile->Close();
+    dir->cd();
+}
+
+#endif /* INPUTFILESUTIL_H_ */
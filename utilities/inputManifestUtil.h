@@ -0,0 +1,170 @@
+/*
+ * input manifest of an analysis : the trees it reads and the branches it uses from each tree.
+ * The manifest is used to
+ *  - disable the branches which are not used (SetBranchStatus), they are not read from disk at GetEntry,
+ *  - skip the trees which are not used, they are not even opened,
+ *  - read a tree only when the analysis first uses it in an event (lazyInput), so the events which are rejected
+ *    by cuts on one tree do not read the others.
+ */
+
+#ifndef INPUTMANIFESTUTIL_H_
+#define INPUTMANIFESTUTIL_H_
+
+#include "TTree.h"
+
+#include "storageUtil.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class inputManifest {
+public :
+    inputManifest(std::string analysisName_) : analysisName(analysisName_) {};
+    ~inputManifest(){};
+
+    void add(std::string inputName, std::vector<std::string> branches);
+    bool has(std::string inputName) const;
+    std::vector<std::string> getBranches(std::string inputName) const;
+    void print() const;
+
+private :
+    std::string analysisName;
+    std::vector<std::string> inputNames;
+    std::vector<std::vector<std::string> > branchLists;
+};
+
+/*
+ * reads the current entry of a tree (or storageReader, or any other source through a function) at the first load() in an event
+ */
+class lazyInput {
+public :
+    lazyInput() : tree(0), reader(0), entry(-1), entryLoaded(-1), nLoads(0), nEntriesSet(0) {};
+    ~lazyInput(){};
+
+    void init(std::string name_, TTree* t) { name = name_; tree = t; };
+    void init(std::string name_, storageReader* r) { name = name_; reader = r; };
+    void init(std::string name_, std::function<void(Long64_t)> loadFunc_) { name = name_; loadFunc = loadFunc_; };
+    bool isActive() const { return (tree != 0 || reader != 0 || loadFunc); };
+    void setEntry(Long64_t entry_) { entry = entry_; nEntriesSet++; };
+    void load();
+    void printStats() const;
+
+private :
+    std::string name;
+    TTree* tree;
+    storageReader* reader;
+    std::function<void(Long64_t)> loadFunc;
+    Long64_t entry;
+    Long64_t entryLoaded;
+    Long64_t nLoads;
+    Long64_t nEntriesSet;
+};
+
+void applyManifest(TTree* t, const std::vector<std::string>& branches);
+TTree* getTreeInManifest(TFile* file, std::string treePath, std::string inputName, const inputManifest& manifest);
+TTree* getTreeInManifest(const std::vector<std::string>& filePaths, std::string treePath, std::string inputName,
+                         const inputManifest& manifest);
+
+/*
+ * declares that input "inputName" is read with the given branches, branch names can end with a wildcard, ex. "jet*".
+ * An empty list means all branches.
+ */
+void inputManifest::add(std::string inputName, std::vector<std::string> branches)
+{
+    inputNames.push_back(inputName);
+    branchLists.push_back(branches);
+}
+
+bool inputManifest::has(std::string inputName) const
+{
+    for (int i = 0; i < (int)inputNames.size(); ++i) {
+        if (inputNames[i] == inputName) return true;
+    }
+    return false;
+}
+
+std::vector<std::string> inputManifest::getBranches(std::string inputName) const
+{
+    for (int i = 0; i < (int)inputNames.size(); ++i) {
+        if (inputNames[i] == inputName) return branchLists[i];
+    }
+    return {};
+}
+
+void inputManifest::print() const
+{
+    std::cout << "##### Input manifest of " << analysisName.c_str() << " #####" << std::endl;
+    for (int i = 0; i < (int)inputNames.size(); ++i) {
+        std::cout << inputNames[i].c_str() << " : ";
+        if (branchLists[i].size() == 0) std::cout << "all branches";
+        for (int j = 0; j < (int)branchLists[i].size(); ++j) {
+            std::cout << branchLists[i][j].c_str() << " ";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "##### Input manifest - END #####" << std::endl;
+}
+
+void lazyInput::load()
+{
+    if (entryLoaded == entry) return;
+
+    if (tree != 0) tree->GetEntry(entry);
+    else if (reader != 0) reader->getEntry(entry);
+    else if (loadFunc) loadFunc(entry);
+    else return;
+
+    entryLoaded = entry;
+    nLoads++;
+}
+
+void lazyInput::printStats() const
+{
+    if (!isActive()) {
+        std::cout << name.c_str() << " : not read" << std::endl;
+        return;
+    }
+    std::cout << name.c_str() << " : read " << nLoads << " out of " << nEntriesSet << " entries" << std::endl;
+}
+
+/*
+ * disables all branches of "t" except "branches", nothing is done if "branches" is empty
+ */
+void applyManifest(TTree* t, const std::vector<std::string>& branches)
+{
+    if (branches.size() == 0) return;
+
+    t->SetBranchStatus("*", 0);
+    for (int i = 0; i < (int)branches.size(); ++i) {
+        t->SetBranchStatus(branches[i].c_str(), 1);
+    }
+}
+
+/*
+ * returns the tree if "inputName" is in the manifest with the unused branches disabled, 0 otherwise
+ */
+TTree* getTreeInManifest(TFile* file, std::string treePath, std::string inputName, const inputManifest& manifest)
+{
+    if (!manifest.has(inputName)) return 0;
+
+    TTree* t = (TTree*)file->Get(treePath.c_str());
+    if (t != 0) applyManifest(t, manifest.getBranches(inputName));
+    return t;
+}
+
+/*
+ * same as above, the tree is read from all files as a TChain which is owned by the caller
+ */
+TTree* getTreeInManifest(const std::vector<std::string>& filePaths, std::string treePath, std::string inputName,
+                         const inputManifest& manifest)
+{
+    if (!manifest.has(inputName)) return 0;
+
+    TTree* t = openChain(filePaths, treePath);
+    if (t != 0) applyManifest(t, manifest.getBranches(inputName));
+    return t;
+}
+
+#endif /* INPUTMANIFESTUTIL_H_ */
@@ -0,0 +1,82 @@
+/*
+ * read-only memory mapping of a whole file (POSIX mmap).
+ * The content is accessed through data() and size() without copying it into a buffer,
+ * pages are loaded by the kernel as they are read.
+ */
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+
+class mappedFile {
+public :
+    mappedFile() : addr(0), len(0) {};
+    ~mappedFile() { close(); };
+
+    bool open(std::string filePath, bool sequential = true);
+    void close();
+
+    const char* data() const { return (const char*)addr; };
+    size_t size() const { return len; };
+
+private :
+    // not copyable, the mapping is released in the destructor
+    mappedFile(const mappedFile&);
+    mappedFile& operator=(const mappedFile&);
+
+    void* addr;
+    size_t len;
+};
+
+/*
+ * maps the file "filePath", returns false if the file cannot be opened or mapped.
+ * An empty file is opened successfully with size() = 0 and data() = 0.
+ * If "sequential" is true, the kernel is told that the file is read from the beginning to the end (read-ahead).
+ */
+bool mappedFile::open(std::string filePath, bool sequential)
+{
+    close();
+
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    len = st.st_size;
+    if (len == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    addr = mmap(0, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the file descriptor is closed
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        addr = 0;
+        len = 0;
+        return false;
+    }
+
+    if (sequential) madvise(addr, len, MADV_SEQUENTIAL);
+
+    return true;
+}
+
+void mappedFile::close()
+{
+    if (addr != 0) munmap(addr, len);
+    addr = 0;
+    len = 0;
+}
+
+#endif /* MAPPEDFILE_H_ */
@@ -4,6 +4,11 @@
 #include <TTree.h>
 #include <TBranch.h>
 
+#include "flatLayoutUtil.h"
+#include "storageUtil.h"
+#include "precisionUtil.h"
+
+#include <iostream>
 #include <vector>
 
 class particleTree {
@@ -14,12 +19,28 @@ public :
     eta = 0;
     phi = 0;
     chg = 0;
+    chgInt8 = 0;
+
+    b_n = 0;
+    b_pt = 0;
+    b_eta = 0;
+    b_phi = 0;
+    b_chg = 0;
 
+    flatCapacity = 0;
+    reducedPrecision = 0;
   };
   ~particleTree(){};
   void setupTreeForReading(TTree *t);
+  void setupTreeForReading(storageReader& r);
   void branchTree(TTree *t);
+  void branchTree(storageWriter& w);
   void clearEvent();
+  void reserve(int n);
+  void setFlatLayout(int capacity);
+  void setReducedPrecision(int value);
+  void encode();
+  void decode();
 
   // Declaration of leaf types
   Int_t           n;
@@ -27,6 +48,7 @@ public :
   std::vector<float>   *eta;
   std::vector<float>   *phi;
   std::vector<float>   *chg;    // charge
+  std::vector<char>    *chgInt8;    // charge as 8-bit integer, written / read as branch "chg" with reduced precision
 
   // List of branches
   TBranch        *b_n;   //!
@@ -34,25 +56,103 @@ public :
   TBranch        *b_eta;   //!
   TBranch        *b_phi;   //!
   TBranch        *b_chg;   //!
+
+  // 0 for vector branches, otherwise the branches are C arrays with counter n, ex. "pt[n]/F"
+  // and this is the initial number of particles the arrays have space for.
+  int flatCapacity;
+  // 0 for full precision, otherwise the kinematics have truncated mantissas and the charge is an 8-bit integer,
+  // see precisionUtil.h. For reading, this is detected from the type of the charge branch.
+  int reducedPrecision;
+  // encode() must be called before Fill() and decode() after GetEntry() for the flat layout and the reduced precision.
+
+private :
+  bool bindFlatLayout();
+
+  flatReadBuffers flatBuffers;
 };
 
 void particleTree::setupTreeForReading(TTree *t)
 {
-    // Set branch addresses and branch pointers
+    // Set branch addresses and branch pointers, the layout of the tree is detected
     if (t->GetBranch("n")) t->SetBranchAddress("n", &n, &b_n);
-    if (t->GetBranch("pt")) t->SetBranchAddress("pt", &pt, &b_pt);
-    if (t->GetBranch("eta")) t->SetBranchAddress("eta", &eta, &b_eta);
-    if (t->GetBranch("phi")) t->SetBranchAddress("phi", &phi, &b_phi);
-    if (t->GetBranch("chg")) t->SetBranchAddress("chg", &chg, &b_chg);
+    setBranchAddressAnyLayout(t, "pt", pt, &b_pt, flatBuffers);
+    setBranchAddressAnyLayout(t, "eta", eta, &b_eta, flatBuffers);
+    setBranchAddressAnyLayout(t, "phi", phi, &b_phi, flatBuffers);
+    reducedPrecision = isInt8TypeName(getBranchTypeName(t, "chg"));
+    if (reducedPrecision > 0) {
+        if (chg == 0) chg = new std::vector<float>();
+        setBranchAddressAnyLayout(t, "chg", chgInt8, &b_chg, flatBuffers);
+    }
+    else {
+        setBranchAddressAnyLayout(t, "chg", chg, &b_chg, flatBuffers);
+    }
+}
+
+/*
+ * reads either a TTree or an RNTuple
+ */
+void particleTree::setupTreeForReading(storageReader& r)
+{
+    if (r.tree) {
+        setupTreeForReading(r.tree);
+        return;
+    }
+    r.setBranchAddress("n", &n);
+    r.setBranchAddress("pt", pt);
+    r.setBranchAddress("eta", eta);
+    r.setBranchAddress("phi", phi);
+    reducedPrecision = isInt8TypeName(r.getBranchTypeName("chg"));
+    if (reducedPrecision > 0) {
+        if (chg == 0) chg = new std::vector<float>();
+        r.setBranchAddress("chg", chgInt8);
+    }
+    else {
+        r.setBranchAddress("chg", chg);
+    }
 }
 
 void particleTree::branchTree(TTree *t)
 {
-    t->Branch("n", &n);
-    t->Branch("pt", &pt);
-    t->Branch("eta", &eta);
-    t->Branch("phi", &phi);
-    t->Branch("chg", &chg);
+    b_n = t->Branch("n", &n);
+    if (flatCapacity > 0) {
+        b_pt = branchFlat(t, "pt", "n", pt, flatCapacity);
+        b_eta = branchFlat(t, "eta", "n", eta, flatCapacity);
+        b_phi = branchFlat(t, "phi", "n", phi, flatCapacity);
+        b_chg = (reducedPrecision > 0) ? branchFlat(t, "chg", "n", chgInt8, flatCapacity) :
+                                         branchFlat(t, "chg", "n", chg, flatCapacity);
+        return;
+    }
+    b_pt = t->Branch("pt", &pt);
+    b_eta = t->Branch("eta", &eta);
+    b_phi = t->Branch("phi", &phi);
+    if (reducedPrecision > 0) {
+        if (chgInt8 == 0) chgInt8 = new std::vector<char>();
+        b_chg = t->Branch("chg", &chgInt8);
+    }
+    else {
+        b_chg = t->Branch("chg", &chg);
+    }
+}
+
+/*
+ * writes either a TTree or an RNTuple, the flat layout is used only for TTree
+ */
+void particleTree::branchTree(storageWriter& w)
+{
+    if (w.tree) {
+        branchTree(w.tree);
+        return;
+    }
+    w.branchScalar("n", &n);
+    w.branchVector("pt", pt);
+    w.branchVector("eta", eta);
+    w.branchVector("phi", phi);
+    if (reducedPrecision > 0) {
+        w.branchVector("chg", chgInt8);
+    }
+    else {
+        w.branchVector("chg", chg);
+    }
 }
 
 void particleTree::clearEvent()
@@ -64,4 +164,88 @@ void particleTree::clearEvent()
     chg->clear();
 }
 
+/*
+ * reserve space for "n" particles
+ */
+void particleTree::reserve(int n)
+{
+    if (flatCapacity > 0) {
+        if (n > flatCapacity) flatCapacity = n;
+        bindFlatLayout();
+        return;
+    }
+    pt->reserve(n);
+    eta->reserve(n);
+    phi->reserve(n);
+    chg->reserve(n);
+    if (chgInt8 != 0) chgInt8->reserve(n);
+}
+
+/*
+ * the branches created by the next branchTree() use the flat layout with space for "capacity" particles
+ */
+void particleTree::setFlatLayout(int capacity)
+{
+    flatCapacity = capacity;
+}
+
+/*
+ * the branches created by the next branchTree() store the kinematics with truncated mantissas and the charge
+ * as an 8-bit integer if "value" > 0
+ */
+void particleTree::setReducedPrecision(int value)
+{
+    reducedPrecision = value;
+    if (reducedPrecision > 0) {
+        // the float charge is filled by the user and not branched
+        if (chg == 0) chg = new std::vector<float>();
+        if (chgInt8 == 0) chgInt8 = new std::vector<char>();
+    }
+}
+
+/*
+ * prepares the current entry for Fill() : converts it to the stored precision, the kinematics are modified in place,
+ * and points the flat branches to the current storage of the vectors, which moves if they grow beyond their capacity.
+ */
+void particleTree::encode()
+{
+    if (reducedPrecision > 0) {
+        truncateMantissa(pt, PRECISION::nBitsPt);
+        truncateMantissa(eta, PRECISION::nBitsEta);
+        truncateMantissa(phi, PRECISION::nBitsPhi);
+        encodeInt8(chg, chgInt8);
+    }
+
+    if (flatCapacity > 0) {
+        if (n > flatCapacity) flatCapacity = n;
+        bindFlatLayout();
+    }
+}
+
+/*
+ * completes the entry after GetEntry() : copies the arrays of the flat layout into the vectors
+ * and restores the float charge for reduced precision
+ */
+void particleTree::decode()
+{
+    flatBuffers.copy(n);
+
+    if (reducedPrecision <= 0) return;
+
+    decodeInt8(chgInt8, chg, n);
+}
+
+/*
+ * points the flat branches to the current storage of the vectors, returns true if any of them had moved
+ */
+bool particleTree::bindFlatLayout()
+{
+    bool moved = false;
+    moved |= bindFlat(b_pt, pt, flatCapacity);
+    moved |= bindFlat(b_eta, eta, flatCapacity);
+    moved |= bindFlat(b_phi, phi, flatCapacity);
+    moved |= (reducedPrecision > 0) ? bindFlat(b_chg, chgInt8, flatCapacity) : bindFlat(b_chg, chg, flatCapacity);
+    return moved;
+}
+
 #endif /* PARTICLETREE_H_ */
@@ -3,6 +3,7 @@
  */
 
 #include <TMath.h>
+#include <TRandom.h>
 #include <TRandom3.h>
 
 #include <string>
@@ -18,10 +19,116 @@ double getAbsDPHI(double phi1, double phi2);
 double getDR(double eta1, double phi1, double eta2, double phi2);
 double getDR2(double eta1, double phi1, double eta2, double phi2);
 double getResolution(double pt, double C, double S, double N);
-double getEnergySmearingFactor(TRandom3 &rand, double pt, double C, double S, double N);
-double getAngleSmearing(TRandom3 &rand, double pt, double C, double S, double N);
+double getEnergySmearingFactor(TRandom &rand, double pt, double C, double S, double N);
+double getAngleSmearing(TRandom &rand, double pt, double C, double S, double N);
 double correctPhiRange(double phi);
 
+/*
+ * counter-based random number generator : Philox4x32-10
+ * J. K. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11, doi:10.1145/2063384.2063405
+ *
+ * The n-th random number is a pure function of (seed, stream, entry, index, n). Call setCounter(entry, index)
+ * before drawing the numbers for a given entry (event) and index (ex. jet index). The results do not depend on
+ * the order in which entries are processed, so they are same for any thread count or sharding of the input.
+ *
+ * It derives from TRandom so that Gaus(), Uniform(), etc. are available, and it can be assigned to gRandom
+ * to make TH1::GetRandom(), TF1::GetRandom() reproducible as well.
+ */
+class counterRNG : public TRandom {
+public :
+    counterRNG(UInt_t seed = 0, UInt_t stream = 0);
+    ~counterRNG(){};
+
+    void setCounter(ULong64_t entry, UInt_t index = 0);
+    Double_t Rndm() override;
+    void RndmArray(Int_t n, Float_t *array) override;
+    void RndmArray(Int_t n, Double_t *array) override;
+
+private :
+    void generateBlock();
+
+    UInt_t key[2];      // {seed, stream}
+    UInt_t ctr[4];      // {block number, index, entry (low bits), entry (high bits)}
+    UInt_t block[4];    // random numbers from the last generated block
+    int iBlock;         // position of the next number to be used in "block"
+};
+
+counterRNG::counterRNG(UInt_t seed, UInt_t stream)
+{
+    key[0] = seed;
+    key[1] = stream;
+    setCounter(0, 0);
+}
+
+void counterRNG::setCounter(ULong64_t entry, UInt_t index)
+{
+    ctr[0] = 0;
+    ctr[1] = index;
+    ctr[2] = (UInt_t)(entry & 0xFFFFFFFF);
+    ctr[3] = (UInt_t)(entry >> 32);
+    iBlock = 4;
+}
+
+/*
+ * 10 rounds of Philox4x32 applied to the current counter, then the block number is incremented.
+ */
+void counterRNG::generateBlock()
+{
+    const ULong64_t M0 = 0xD2511F53;
+    const ULong64_t M1 = 0xCD9E8D57;
+    const UInt_t W0 = 0x9E3779B9;
+    const UInt_t W1 = 0xBB67AE85;
+
+    UInt_t x[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+    UInt_t k[2] = {key[0], key[1]};
+    for (int iRound = 0; iRound < 10; ++iRound) {
+        ULong64_t prod0 = M0 * x[0];
+        ULong64_t prod1 = M1 * x[2];
+        UInt_t hi0 = (UInt_t)(prod0 >> 32);
+        UInt_t lo0 = (UInt_t)prod0;
+        UInt_t hi1 = (UInt_t)(prod1 >> 32);
+        UInt_t lo1 = (UInt_t)prod1;
+
+        x[0] = hi1 ^ x[1] ^ k[0];
+        x[1] = lo1;
+        x[2] = hi0 ^ x[3] ^ k[1];
+        x[3] = lo0;
+
+        k[0] += W0;
+        k[1] += W1;
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        block[i] = x[i];
+    }
+    ctr[0]++;
+    iBlock = 0;
+}
+
+/*
+ * returns a uniform random number in (0, 1), 0 and 1 are excluded.
+ */
+Double_t counterRNG::Rndm()
+{
+    if (iBlock == 4) generateBlock();
+
+    return ((Double_t)block[iBlock++] + 0.5) * 2.3283064365386963e-10;  // 2^-32
+}
+
+void counterRNG::RndmArray(Int_t n, Float_t *array)
+{
+    for (int i = 0; i < n; ++i) {
+        array[i] = (Float_t)Rndm();
+    }
+}
+
+void counterRNG::RndmArray(Int_t n, Double_t *array)
+{
+    for (int i = 0; i < n; ++i) {
+        array[i] = Rndm();
+    }
+}
+
 double getDETA(double eta1, double eta2)
 {
     return eta1 - eta2;
@@ -75,7 +182,7 @@ double getResolution(double pt, double C, double S, double N)
     return TMath::Sqrt( C*C + (S*S)/pt + (N*N)/(pt*pt) );
 }
 
-double getEnergySmearingFactor(TRandom3 &rand, double pt, double C, double S, double N)
+double getEnergySmearingFactor(TRandom &rand, double pt, double C, double S, double N)
 {
     double sigma = getResolution(pt, C, S, N);
 
@@ -87,7 +194,7 @@ double getEnergySmearingFactor(TRandom3 &rand, double pt, double C, double S, do
     return smearFactor;
 }
 
-double getAngleSmearing(TRandom3 &rand, double pt, double C, double S, double N)
+double getAngleSmearing(TRandom &rand, double pt, double C, double S, double N)
 {
     double sigma = getResolution(pt, C, S, N);
 
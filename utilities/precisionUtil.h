@@ -0,0 +1,104 @@
+/*
+ * utilities for the reduced precision storage of the particle and jet trees.
+ * The kinematics stay floats, but the lowest bits of the mantissa are set to 0 (rounded to nearest) before Fill().
+ * The type on disk does not change, so the readers need no change, and the zeroed bits compress to almost nothing.
+ * With "nBits" mantissa bits kept, the relative precision is 2^-(nBits+1) :
+ *  - pt : 10 bits, relative precision 4.9e-4
+ *  - eta, phi : 12 bits, relative precision 1.2e-4, absolute precision 2.4e-4 for |phi| < 4 and 4.9e-4 for 4 < |eta| < 8
+ * The charge, which is -1, 0 or +1, is stored as an 8-bit integer (Char_t) instead of a float.
+ * The reader detects the type of the charge branch and decodes it into the float vector, see particleTree::decode().
+ */
+
+#ifndef PRECISIONUTIL_H_
+#define PRECISIONUTIL_H_
+
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace PRECISION {
+
+const int nBitsPt = 10;
+const int nBitsEta = 12;
+const int nBitsPhi = 12;
+
+};
+
+float truncateMantissa(float x, int nBits);
+void truncateMantissa(std::vector<float>* v, int nBits);
+void encodeInt8(const std::vector<float>* src, std::vector<char>* dst);
+void decodeInt8(const std::vector<char>* src, std::vector<float>* dst, int n);
+bool isInt8TypeName(std::string typeName);
+
+/*
+ * keeps "nBits" of the 23 mantissa bits of "x", the result is rounded to the nearest value
+ */
+float truncateMantissa(float x, int nBits)
+{
+    if (nBits >= 23 || nBits < 0) return x;
+
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    // inf and NaN are kept as they are
+    if ((bits & 0x7f800000) == 0x7f800000) return x;
+
+    int nDropped = 23 - nBits;
+    uint32_t mask = ~((1u << nDropped) - 1);
+    // a carry into the exponent gives the next power of 2, which is the correctly rounded value
+    bits = (bits + (1u << (nDropped - 1))) & mask;
+
+    float res;
+    std::memcpy(&res, &bits, sizeof(res));
+    return res;
+}
+
+void truncateMantissa(std::vector<float>* v, int nBits)
+{
+    if (v == 0) return;
+
+    int n = v->size();
+    for (int i = 0; i < n; ++i) {
+        (*v)[i] = truncateMantissa((*v)[i], nBits);
+    }
+}
+
+/*
+ * rounds the entries of "src" into "dst", "dst" is resized to the size of "src"
+ */
+void encodeInt8(const std::vector<float>* src, std::vector<char>* dst)
+{
+    if (src == 0 || dst == 0) return;
+
+    int n = src->size();
+    dst->resize(n);
+    for (int i = 0; i < n; ++i) {
+        (*dst)[i] = (char)std::lround((*src)[i]);
+    }
+}
+
+/*
+ * decodes the first "n" entries of "src" into "dst", "dst" is resized to "n".
+ * "n" is needed as "src" is larger than the entry in the flat layout.
+ */
+void decodeInt8(const std::vector<char>* src, std::vector<float>* dst, int n)
+{
+    if (src == 0 || dst == 0) return;
+
+    dst->resize(n);
+    for (int i = 0; i < n; ++i) {
+        (*dst)[i] = (float)(*src)[i];
+    }
+}
+
+/*
+ * returns true if "typeName" is the type of an 8-bit integer branch, either a vector, a C array or an RNTuple field
+ */
+bool isInt8TypeName(std::string typeName)
+{
+    return (typeName == "Char_t" || typeName == "char" ||
+            typeName == "vector<char>" || typeName == "vector<Char_t>" || typeName == "std::vector<char>");
+}
+
+#endif /* PRECISIONUTIL_H_ */
@@ -0,0 +1,77 @@
+/*
+ * metadata of a shard, the output of a job over a part of the events, used for the weighted merging of shards (mergeShards.cc).
+ * It is a histogram so that it adds up when the shards are merged :
+ *  - bin 1 is the sum of xsec * nEvents over the input files of the job,
+ *  - bin 2 is the number of events.
+ * The cross section of merged shards is then the average weighted by the number of events.
+ * The unit of the cross section is that of the generator, ex. mb for Pythia and pb for JETPHOX.
+ */
+
+#ifndef SHARDINFOUTIL_H_
+#define SHARDINFOUTIL_H_
+
+#include "TDirectory.h"
+#include "TH1.h"
+#include "TH1D.h"
+
+#include <string>
+
+namespace SHARDINFO {
+
+const std::string name = "h_shardInfo";
+
+};
+
+TH1D* newShardInfo();
+void addShardInfo(TH1D* h, double xsec, double nEvents);
+bool getShardInfo(TH1* h, double& xsec, double& nEvents);
+bool readShardInfo(TDirectory* dir, double& xsec, double& nEvents);
+
+/*
+ * creates the histogram in the current directory
+ */
+TH1D* newShardInfo()
+{
+    TH1D* h = new TH1D(SHARDINFO::name.c_str(), ";;", 2, 0, 2);
+    h->GetXaxis()->SetBinLabel(1, "xsec x nEvents");
+    h->GetXaxis()->SetBinLabel(2, "nEvents");
+    return h;
+}
+
+/*
+ * adds an input file with "nEvents" events generated with cross section "xsec"
+ */
+void addShardInfo(TH1D* h, double xsec, double nEvents)
+{
+    if (h == 0 || nEvents <= 0) return;
+
+    h->SetBinContent(1, h->GetBinContent(1) + xsec * nEvents);
+    h->SetBinContent(2, h->GetBinContent(2) + nEvents);
+}
+
+/*
+ * returns false if there are no events
+ */
+bool getShardInfo(TH1* h, double& xsec, double& nEvents)
+{
+    if (h == 0) return false;
+
+    nEvents = h->GetBinContent(2);
+    if (nEvents <= 0) return false;
+    xsec = h->GetBinContent(1) / nEvents;
+    return true;
+}
+
+/*
+ * returns false if "dir" has no shard info or the info has no events
+ */
+bool readShardInfo(TDirectory* dir, double& xsec, double& nEvents)
+{
+    TH1* h = 0;
+    dir->GetObject(SHARDINFO::name.c_str(), h);
+    bool res = getShardInfo(h, xsec, nEvents);
+    delete h;
+    return res;
+}
+
+#endif /* SHARDINFOUTIL_H_ */
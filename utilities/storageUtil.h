@@ -0,0 +1,500 @@
+/*
+ * common interface to write and read the particle and jet trees either as TTree or as RNTuple.
+ * The tree classes (particleTree, fastJetTree) register their branches with storageWriter / storageReader,
+ * the code which fills or reads the member variables is the same for both backends.
+ * RNTuple is available for ROOT >= 6.32, programs using it must be linked with -lROOTNTuple.
+ */
+
+#ifndef STORAGEUTIL_H_
+#define STORAGEUTIL_H_
+
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TKey.h"
+#include "TChain.h"
+#include "RVersion.h"
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,32,0)
+#define HAS_RNTUPLE
+#include <ROOT/REntry.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleWriter.hxx>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,36,0)
+namespace RNTUPLE = ROOT;
+#else
+namespace RNTUPLE = ROOT::Experimental;
+#endif
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "inputFilesUtil.h"
+
+namespace STORAGE {
+
+enum BACKENDS {
+    kTTree,
+    kRNTuple,
+    kN_BACKENDS
+};
+
+const std::string BACKENDNAMES[kN_BACKENDS] = {"TTree", "RNTuple"};
+
+};
+
+int getStorageBackendIndex(std::string backendName);
+int getStorageBackend(TFile* file, std::string name);
+std::string getBranchTypeName(TTree* t, const char* name);
+
+/*
+ * writes one tree or RNTuple into a file.
+ * For RNTuple, the writer is created at the first fill() after all the branches are registered
+ * and close() must be called before the file is closed.
+ */
+class storageWriter {
+public :
+    storageWriter(TFile* file, std::string name, std::string title, int backend);
+    ~storageWriter() { close(); };
+
+    void branchScalar(const char* name, Int_t* value);
+    void branchScalar(const char* name, Float_t* value);
+    template <typename T> void branchVector(const char* name, std::vector<T>*& v);
+    void fill();
+    void close();
+
+    int backend;
+    TTree* tree;    // 0 for RNTuple
+
+private :
+    storageWriter(const storageWriter&);
+    storageWriter& operator=(const storageWriter&);
+
+    TFile* file;
+    std::string name;
+#ifdef HAS_RNTUPLE
+    std::unique_ptr<RNTUPLE::RNTupleModel> model;
+    std::unique_ptr<RNTUPLE::RNTupleWriter> writer;
+    // member variables of the tree classes and the field values they are copied into at fill()
+    std::vector<std::pair<Int_t*, std::shared_ptr<Int_t> > > scalarsI;
+    std::vector<std::pair<Float_t*, std::shared_ptr<Float_t> > > scalarsF;
+#endif
+};
+
+/*
+ * reads a tree or an RNTuple, the backend is detected from the file.
+ * For RNTuple, only the registered fields are read.
+ * A tree or an RNTuple can be read from a list of files, the entries of the files are numbered one after the other
+ * as in a TChain. For RNTuple, the files are read by one reader per file, opened at the first entry of the file.
+ */
+class storageReader {
+public :
+    storageReader(TFile* file, std::string name);
+    storageReader(const std::vector<std::string>& filePaths, std::string name);
+    ~storageReader() { delete chain; };
+
+    bool isValid() const { return backend >= 0; };
+    bool hasBranch(const char* name) const;
+    std::string getBranchTypeName(const char* name) const;
+    void setActiveBranches(const std::vector<std::string>& branches);
+    void setBranchAddress(const char* name, Int_t* value);
+    void setBranchAddress(const char* name, Float_t* value);
+    template <typename T> void setBranchAddress(const char* name, std::vector<T>*& v);
+    Long64_t getEntries() const;
+    void getEntry(Long64_t entry);
+
+    int backend;
+    TTree* tree;    // 0 for RNTuple
+
+private :
+    storageReader(const storageReader&);
+    storageReader& operator=(const storageReader&);
+    void openRNTuple();
+
+    TChain* chain;      // owned, 0 if the tree is read from a single file
+    std::string filePath;
+    std::vector<std::string> filePaths;
+    std::string name;
+    std::vector<std::string> activeBranches;    // empty for all
+#ifdef HAS_RNTUPLE
+    std::unique_ptr<RNTUPLE::RNTupleReader> readerMeta;     // metadata of all fields in the first file, does not read entries
+    std::unique_ptr<RNTUPLE::RNTupleModel> model;           // registered fields, cloned for the reader of each file
+    std::unique_ptr<RNTUPLE::RNTupleReader> reader;         // reader of the current file
+    std::unique_ptr<RNTUPLE::REntry> entryValues;           // entry of "reader" with the values below bound to it
+    std::vector<std::function<void(RNTUPLE::REntry&)> > bindValues;
+    std::vector<std::pair<Int_t*, std::shared_ptr<Int_t> > > scalarsI;
+    std::vector<std::pair<Float_t*, std::shared_ptr<Float_t> > > scalarsF;
+    std::vector<Long64_t> entryOffsets;     // first entry of each file, the last element is the number of entries
+    int iFileCurrent;
+#endif
+};
+
+/*
+ * returns the index of the backend in STORAGE::BACKENDNAMES, -1 if it is not valid or not available in this ROOT version
+ */
+int getStorageBackendIndex(std::string backendName)
+{
+    for (int i = 0; i < STORAGE::kN_BACKENDS; ++i) {
+        if (backendName == STORAGE::BACKENDNAMES[i]) {
+#ifndef HAS_RNTUPLE
+            if (i == STORAGE::kRNTuple) return -1;
+#endif
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ * returns the backend of object "name" in "file", -1 if there is no such object.
+ * An RNTuple must be at the top directory of the file.
+ */
+int getStorageBackend(TFile* file, std::string name)
+{
+    TKey* key = file->GetKey(name.c_str());
+    if (key != 0) {
+        std::string className = key->GetClassName();
+        if (className.find("RNTuple") != std::string::npos) return STORAGE::kRNTuple;
+    }
+
+    TTree* t = 0;
+    file->GetObject(name.c_str(), t);
+    return (t != 0) ? STORAGE::kTTree : -1;
+}
+
+/*
+ * returns the type of branch "name", ex. "vector<float>" or "Float_t" for a C array, "" if there is no such branch
+ */
+std::string getBranchTypeName(TTree* t, const char* name)
+{
+    TBranch* b = t->GetBranch(name);
+    if (b == 0) return "";
+
+    std::string className = b->GetClassName();
+    if (className.size() > 0) return className;
+
+    TLeaf* leaf = b->GetLeaf(name);
+    return (leaf != 0) ? leaf->GetTypeName() : "";
+}
+
+storageWriter::storageWriter(TFile* file_, std::string name_, std::string title, int backend_)
+{
+    file = file_;
+    name = name_;
+    backend = backend_;
+    tree = 0;
+
+    if (backend == STORAGE::kTTree) {
+        file->cd();
+        tree = new TTree(name.c_str(), title.c_str());
+    }
+#ifdef HAS_RNTUPLE
+    else if (backend == STORAGE::kRNTuple) {
+        model = RNTUPLE::RNTupleModel::Create();
+        model->SetDescription(title);
+    }
+#endif
+}
+
+void storageWriter::branchScalar(const char* name, Int_t* value)
+{
+    if (tree) {
+        tree->Branch(name, value);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    scalarsI.push_back(std::make_pair(value, model->MakeField<Int_t>(name)));
+#endif
+}
+
+void storageWriter::branchScalar(const char* name, Float_t* value)
+{
+    if (tree) {
+        tree->Branch(name, value);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    scalarsF.push_back(std::make_pair(value, model->MakeField<Float_t>(name)));
+#endif
+}
+
+/*
+ * for RNTuple, "v" is pointed to the value of the field. The field owns the vector.
+ */
+template <typename T>
+void storageWriter::branchVector(const char* name, std::vector<T>*& v)
+{
+    if (tree) {
+        tree->Branch(name, &v);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    v = model->MakeField<std::vector<T> >(name).get();
+#endif
+}
+
+void storageWriter::fill()
+{
+    if (tree) {
+        tree->Fill();
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    if (!writer) {
+        writer = RNTUPLE::RNTupleWriter::Append(std::move(model), name, *file);
+    }
+    for (int i = 0; i < (int)scalarsI.size(); ++i) {
+        *scalarsI[i].second = *scalarsI[i].first;
+    }
+    for (int i = 0; i < (int)scalarsF.size(); ++i) {
+        *scalarsF[i].second = *scalarsF[i].first;
+    }
+    writer->Fill();
+#endif
+}
+
+/*
+ * RNTuple is written into the file, nothing is done for TTree as it is written with the file
+ */
+void storageWriter::close()
+{
+#ifdef HAS_RNTUPLE
+    if (backend != STORAGE::kRNTuple) return;
+    // RNTuple without entries
+    if (!writer && model) {
+        writer = RNTUPLE::RNTupleWriter::Append(std::move(model), name, *file);
+    }
+    writer.reset();
+#endif
+}
+
+storageReader::storageReader(TFile* file, std::string name_)
+{
+    filePath = file->GetName();
+    filePaths.push_back(filePath);
+    name = name_;
+    tree = 0;
+    chain = 0;
+
+    backend = getStorageBackend(file, name);
+    if (backend == STORAGE::kTTree) {
+        tree = (TTree*)file->Get(name.c_str());
+    }
+    else if (backend == STORAGE::kRNTuple) {
+        openRNTuple();
+    }
+    else {
+        std::cout << "ERROR : " << name.c_str() << " is not found in file " << filePath.c_str() << std::endl;
+    }
+}
+
+/*
+ * the backend is detected from the first file
+ */
+storageReader::storageReader(const std::vector<std::string>& filePaths_, std::string name_)
+{
+    filePaths = filePaths_;
+    name = name_;
+    tree = 0;
+    chain = 0;
+    backend = -1;
+
+    if (filePaths.size() == 0) {
+        std::cout << "ERROR : there is no input file for " << name.c_str() << std::endl;
+        return;
+    }
+    filePath = filePaths[0];
+
+    TFile* file = TFile::Open(filePath.c_str(), "READ");
+    if (file == 0) {
+        std::cout << "ERROR : file " << filePath.c_str() << " cannot be opened" << std::endl;
+        return;
+    }
+    backend = getStorageBackend(file, name);
+    file->Close();
+    delete file;
+
+    if (backend == STORAGE::kTTree) {
+        chain = openChain(filePaths, name);
+        tree = chain;
+        if (chain == 0) backend = -1;
+    }
+    else if (backend == STORAGE::kRNTuple) {
+        openRNTuple();
+    }
+    else {
+        std::cout << "ERROR : " << name.c_str() << " is not found in file " << filePath.c_str() << std::endl;
+    }
+}
+
+void storageReader::openRNTuple()
+{
+#ifdef HAS_RNTUPLE
+    readerMeta = RNTUPLE::RNTupleReader::Open(name, filePath);
+    model = RNTUPLE::RNTupleModel::Create();
+    iFileCurrent = -1;
+
+    entryOffsets.assign(1, 0);
+    for (int i = 0; i < (int)filePaths.size(); ++i) {
+        Long64_t nEntries = (i == 0) ? readerMeta->GetNEntries()
+                                     : RNTUPLE::RNTupleReader::Open(name, filePaths[i])->GetNEntries();
+        entryOffsets.push_back(entryOffsets.back() + nEntries);
+    }
+#else
+    std::cout << "ERROR : " << name.c_str() << " is an RNTuple, RNTuple requires ROOT >= 6.32" << std::endl;
+    backend = -1;
+#endif
+}
+
+/*
+ * returns true if the branch exists and is active
+ */
+bool storageReader::hasBranch(const char* name) const
+{
+    if (tree) return (tree->GetBranch(name) != 0 && tree->GetBranchStatus(name));
+#ifdef HAS_RNTUPLE
+    if (readerMeta) {
+        if (readerMeta->GetDescriptor().FindFieldId(name) == RNTUPLE::kInvalidDescriptorId) return false;
+        if (activeBranches.size() == 0) return true;
+        std::string nameStr = name;
+        for (int i = 0; i < (int)activeBranches.size(); ++i) {
+            const std::string& pattern = activeBranches[i];
+            if (pattern == nameStr) return true;
+            // wildcard at the end, ex. "jet*"
+            if (pattern.size() > 0 && pattern.back() == '*' &&
+                nameStr.compare(0, pattern.size()-1, pattern, 0, pattern.size()-1) == 0) return true;
+        }
+        return false;
+    }
+#endif
+    return false;
+}
+
+/*
+ * for RNTuple, the type of the field, ex. "std::vector<float>"
+ */
+std::string storageReader::getBranchTypeName(const char* name) const
+{
+    if (tree) return ::getBranchTypeName(tree, name);
+#ifdef HAS_RNTUPLE
+    if (readerMeta) {
+        const auto& desc = readerMeta->GetDescriptor();
+        auto fieldId = desc.FindFieldId(name);
+        if (fieldId == RNTUPLE::kInvalidDescriptorId) return "";
+        return desc.GetFieldDescriptor(fieldId).GetTypeName();
+    }
+#endif
+    return "";
+}
+
+/*
+ * only "branches" are read, names can end with a wildcard, ex. "jet*". This must be called before the branches are set up.
+ * For RNTuple, the fields which are not active are not registered by setBranchAddress().
+ */
+void storageReader::setActiveBranches(const std::vector<std::string>& branches)
+{
+    activeBranches = branches;
+    if (tree && branches.size() > 0) {
+        tree->SetBranchStatus("*", 0);
+        for (int i = 0; i < (int)branches.size(); ++i) {
+            tree->SetBranchStatus(branches[i].c_str(), 1);
+        }
+    }
+}
+
+void storageReader::setBranchAddress(const char* name, Int_t* value)
+{
+    if (!hasBranch(name)) return;
+    if (tree) {
+        tree->SetBranchAddress(name, value);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    std::shared_ptr<Int_t> valuePtr = model->MakeField<Int_t>(name);
+    std::string fieldName = name;
+    scalarsI.push_back(std::make_pair(value, valuePtr));
+    bindValues.push_back([fieldName, valuePtr](RNTUPLE::REntry& e) { e.BindValue(fieldName, valuePtr); });
+#endif
+}
+
+void storageReader::setBranchAddress(const char* name, Float_t* value)
+{
+    if (!hasBranch(name)) return;
+    if (tree) {
+        tree->SetBranchAddress(name, value);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    std::shared_ptr<Float_t> valuePtr = model->MakeField<Float_t>(name);
+    std::string fieldName = name;
+    scalarsF.push_back(std::make_pair(value, valuePtr));
+    bindValues.push_back([fieldName, valuePtr](RNTUPLE::REntry& e) { e.BindValue(fieldName, valuePtr); });
+#endif
+}
+
+/*
+ * for RNTuple, "v" is pointed to the value of the field
+ */
+template <typename T>
+void storageReader::setBranchAddress(const char* name, std::vector<T>*& v)
+{
+    if (!hasBranch(name)) return;
+    if (tree) {
+        tree->SetBranchAddress(name, &v);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    std::shared_ptr<std::vector<T> > valuePtr = model->MakeField<std::vector<T> >(name);
+    std::string fieldName = name;
+    v = valuePtr.get();
+    bindValues.push_back([fieldName, valuePtr](RNTUPLE::REntry& e) { e.BindValue(fieldName, valuePtr); });
+#endif
+}
+
+Long64_t storageReader::getEntries() const
+{
+    if (tree) return tree->GetEntries();
+#ifdef HAS_RNTUPLE
+    if (readerMeta) return entryOffsets.back();
+#endif
+    return 0;
+}
+
+void storageReader::getEntry(Long64_t entry)
+{
+    if (tree) {
+        tree->GetEntry(entry);
+        return;
+    }
+#ifdef HAS_RNTUPLE
+    int iFile = (int)(std::upper_bound(entryOffsets.begin(), entryOffsets.end(), entry) - entryOffsets.begin()) - 1;
+    if (iFile < 0 || iFile >= (int)filePaths.size()) return;
+
+    // the field values are shared by the readers of all files, so "v" of setBranchAddress() stays valid
+    if (!reader || iFile != iFileCurrent) {
+        reader = RNTUPLE::RNTupleReader::Open(model->Clone(), name, filePaths[iFile]);
+        entryValues = reader->GetModel().CreateBareEntry();
+        for (int i = 0; i < (int)bindValues.size(); ++i) {
+            bindValues[i](*entryValues);
+        }
+        iFileCurrent = iFile;
+    }
+    reader->LoadEntry(entry - entryOffsets[iFile], *entryValues);
+    for (int i = 0; i < (int)scalarsI.size(); ++i) {
+        *scalarsI[i].first = *scalarsI[i].second;
+    }
+    for (int i = 0; i < (int)scalarsF.size(); ++i) {
+        *scalarsF[i].first = *scalarsF[i].second;
+    }
+#endif
+}
+
+#endif /* STORAGEUTIL_H_ */
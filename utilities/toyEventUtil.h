@@ -0,0 +1,90 @@
+/*
+ * utilities to sample toy events
+ */
+
+#ifndef TOYEVENTUTIL_H_
+#define TOYEVENTUTIL_H_
+
+#include "TF1.h"
+#include "TMath.h"
+#include "TRandom.h"
+
+#include "particleTree.h"
+
+#include <string>
+
+/*
+ * samples thermal events : pt from p(pt) ~ pt * exp(-2*pt/meanPt), eta uniform in (-maxEta, maxEta),
+ * phi uniform in (-pi, pi). The number of charged particles is uniform in [minMultCh, maxMultCh],
+ * the number of neutral particles is ratioChNeutral * (number of charged particles).
+ */
+class thermalEventSampler {
+public :
+    thermalEventSampler(int minMultCh, int maxMultCh, double meanPt, double maxEta, double minPt = 0,
+                        std::string name = "fncPt");
+    ~thermalEventSampler(){};
+
+    void sample(TRandom& rand, particleTree& particles);
+
+    int minMultCh;
+    int maxMultCh;
+    double maxEta;
+    double minPt;
+    double ratioChNeutral;
+
+    TF1* fncPt;
+};
+
+thermalEventSampler::thermalEventSampler(int minMultCh_, int maxMultCh_, double meanPt, double maxEta_, double minPt_,
+                                         std::string name)
+{
+    minMultCh = minMultCh_;
+    maxMultCh = maxMultCh_;
+    maxEta = maxEta_;
+    minPt = minPt_;
+    ratioChNeutral = 0.5;
+
+    // taken from https://github.com/JetQuenchingTools/JetToyHI/blob/c80710caee0c3687707e5d676f3a97dda7c73a25/include/thermalEvent.hh#L45
+    fncPt = new TF1(name.c_str(),"[0]*TMath::Power([1], 2)*x*TMath::Exp(-[1]*x)", 0.2, 200);
+    fncPt->SetParNames("Amplitude", "b (GeV/c)^{-1}");
+    fncPt->SetParameters(1., 2./meanPt);
+}
+
+/*
+ * appends the particles of one thermal event to "particles" using "rand" for all random numbers
+ */
+void thermalEventSampler::sample(TRandom& rand, particleTree& particles)
+{
+    // TF1::GetRandom() uses gRandom
+    TRandom* gRandomOrig = gRandom;
+    gRandom = &rand;
+
+    // {charged multiplicity, neutral multiplicity}
+    int mults[2];
+    mults[0] = (int)(rand.Uniform(minMultCh, maxMultCh+1));
+    mults[1] = mults[0] * ratioChNeutral;
+    particles.reserve(particles.n + mults[0] + mults[1]);
+
+    for (int iCh = 0; iCh < 2; ++iCh) {
+
+        for (int i = 0; i < mults[iCh]; ++i) {
+
+            double pt = fncPt->GetRandom();
+            if (pt < minPt) continue;
+
+            double eta = rand.Uniform(-maxEta, maxEta);
+            double phi = rand.Uniform(-1*TMath::Pi(), TMath::Pi());
+
+            particles.pt->push_back(pt);
+            particles.eta->push_back(eta);
+            particles.phi->push_back(phi);
+
+            particles.chg->push_back(((iCh == 0) ? 1 : 0));
+            particles.n++;
+        }
+    }
+
+    gRandom = gRandomOrig;
+}
+
+#endif /* TOYEVENTUTIL_H_ */
@@ -0,0 +1,159 @@
+/*
+ * common setup of the trees read by a job :
+ *  - TTreeCache, the baskets of the used branches are read with a few large reads instead of one read per basket,
+ *  - asynchronous prefetching, the next cache block is read in a separate thread while the current one is processed,
+ *  - implicit multi-threading, the baskets of the branches of an entry are decompressed in parallel at GetEntry.
+ * The trees read in lockstep (ex. event and jet trees from two files) have one cache each.
+ * Only the branches which are enabled when a tree is added are registered in its cache, so the branches
+ * disabled by an input manifest (inputManifestUtil.h) are not read.
+ * A TChain keeps one cache for all its files : the cache is moved to the next file together with the registered
+ * branches and its read counters.
+ */
+
+#ifndef TREEREADUTIL_H_
+#define TREEREADUTIL_H_
+
+#include "TROOT.h"
+#include "TEnv.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+#include "RConfigure.h"
+
+#include "storageUtil.h"
+#include "ArgumentParser.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class treeReadSetup {
+public :
+    treeReadSetup() : cacheSizeMB(30), asyncPrefetch(0), nThreadsRead(0) {};
+    ~treeReadSetup(){};
+
+    void parseOptions(const std::vector<std::string>& argOptions);
+    void printOptions() const;
+    void printUsage() const;
+    void init();
+    void add(std::string name, TTree* t);
+    void add(std::string name, storageReader* r);
+    void printStats() const;
+
+    int cacheSizeMB;      // size of the TTreeCache of each tree, 0 disables the cache
+    int asyncPrefetch;    // 1 to read the next cache block asynchronously
+    int nThreadsRead;     // number of threads for implicit MT, 0 disables it
+
+private :
+    std::vector<std::string> names;
+    std::vector<TTree*> trees;
+};
+
+void treeReadSetup::parseOptions(const std::vector<std::string>& argOptions)
+{
+    cacheSizeMB = (ArgumentParser::ParseOptionInputSingle("--cacheSizeMB", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--cacheSizeMB", argOptions).c_str()) : 30;
+    asyncPrefetch = (ArgumentParser::ParseOptionInputSingle("--asyncPrefetch", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--asyncPrefetch", argOptions).c_str()) : 0;
+    nThreadsRead = (ArgumentParser::ParseOptionInputSingle("--nThreadsRead", argOptions).size() > 0) ?
+            std::atoi(ArgumentParser::ParseOptionInputSingle("--nThreadsRead", argOptions).c_str()) : 0;
+}
+
+/*
+ * lines for the "Optional Arguments" block of the job
+ */
+void treeReadSetup::printOptions() const
+{
+    std::cout << "cacheSizeMB = " << cacheSizeMB << std::endl;
+    std::cout << "asyncPrefetch = " << asyncPrefetch << std::endl;
+    std::cout << "nThreadsRead = " << nThreadsRead << std::endl;
+}
+
+/*
+ * lines for the "Options are" list of the usage message
+ */
+void treeReadSetup::printUsage() const
+{
+    std::cout << "--cacheSizeMB=<size of the TTreeCache of each input tree in MB, 0 to disable>" << std::endl;
+    std::cout << "--asyncPrefetch=<1 to prefetch the cache blocks asynchronously>" << std::endl;
+    std::cout << "--nThreadsRead=<number of threads to decompress the baskets, 0 to disable>" << std::endl;
+}
+
+/*
+ * must be called before the trees are added, the prefetching thread is created together with the cache
+ */
+void treeReadSetup::init()
+{
+    if (asyncPrefetch > 0) {
+        gEnv->SetValue("TFile.AsyncPrefetching", 1);
+    }
+    if (nThreadsRead > 0) {
+#ifdef R__USE_IMT
+        ROOT::EnableImplicitMT(nThreadsRead);
+#else
+        std::cout << "WARNING : ROOT is built without implicit MT support, nThreadsRead is ignored." << std::endl;
+#endif
+    }
+}
+
+/*
+ * creates the cache of "t" with the enabled branches, nothing is done if "t" is 0
+ */
+void treeReadSetup::add(std::string name, TTree* t)
+{
+    if (t == 0) return;
+
+    names.push_back(name);
+    trees.push_back(t);
+
+    if (cacheSizeMB <= 0) return;
+
+    // the cache is attached to a file, a TChain has no current file before its first tree is loaded
+    t->LoadTree(0);
+    t->SetCacheSize((Long64_t)cacheSizeMB * 1024 * 1024);
+    // disabled branches are skipped by the cache
+    t->AddBranchToCache("*", true);
+    t->StopCacheLearningPhase();
+}
+
+/*
+ * only the TTree backend is set up, RNTuple schedules its own cluster reads
+ */
+void treeReadSetup::add(std::string name, storageReader* r)
+{
+    if (r == 0) return;
+    add(name, r->tree);
+}
+
+/*
+ * must be called before the input files are closed
+ */
+void treeReadSetup::printStats() const
+{
+    std::cout << "##### Tree read statistics #####" << std::endl;
+    std::cout << std::setw(15) << "tree" << std::setw(15) << "MB read" << std::setw(15) << "read calls"
+              << std::setw(15) << "cache hits" << std::setw(20) << "prefetched used" << std::endl;
+    for (int i = 0; i < (int)trees.size(); ++i) {
+        TFile* file = trees[i]->GetCurrentFile();
+        if (file == 0) continue;
+
+        // hit rate is the fraction of basket reads served by the cache,
+        // prefetched used is the fraction of prefetched baskets that were read.
+        // With a cache, MB read and read calls are those of the tree summed over all files of a TChain.
+        // Without a cache, they are for the whole current file, the same for the trees in the same file.
+        TTreeCache* cache = (TTreeCache*)trees[i]->GetReadCache(file);
+        double hitRate = (cache != 0) ? cache->GetEfficiencyRel() : 0;
+        double prefetchedUsed = (cache != 0) ? cache->GetEfficiency() : 0;
+        Long64_t bytesRead = (cache != 0) ? cache->GetBytesRead() + cache->GetNoCacheBytesRead() : file->GetBytesRead();
+        Int_t readCalls = (cache != 0) ? cache->GetReadCalls() + cache->GetNoCacheReadCalls() : file->GetReadCalls();
+
+        std::cout << std::setw(15) << names[i].c_str() << std::setw(15) << (double)bytesRead / (1024 * 1024)
+                  << std::setw(15) << readCalls << std::setw(15) << hitRate
+                  << std::setw(20) << prefetchedUsed << std::endl;
+    }
+    std::cout << "##### Tree read statistics - END #####" << std::endl;
+}
+
+#endif /* TREEREADUTIL_H_ */